@@ -54,3 +54,22 @@ AliCFCutBase::AliCFCutBase(const AliCFCutBase& obj):
   // Copy Constructor
   //
 }
+
+//___________________________________________________________________________
+Int_t AliCFCutBase::IsSelected(Int_t n, TObject** objects, Bool_t* mask)
+{
+  //
+  // Selection of an array of n objects: only the objects with mask[i] set
+  // are checked, mask[i] is reset for the objects failing the cut.
+  // Returns the number of selected objects.
+  // The default calls IsSelected(TObject*) for each object, derived classes
+  // can evaluate their conditions over the whole array.
+  //
+  Int_t nSelected = 0;
+  for (Int_t i=0; i<n; i++) {
+    if (!mask[i]) continue;
+    if (IsSelected(objects[i])) nSelected++;
+    else mask[i] = kFALSE;
+  }
+  return nSelected;
+}
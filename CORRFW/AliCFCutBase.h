@@ -31,6 +31,8 @@ class AliCFCutBase : public AliAnalysisCuts
   AliCFCutBase(const char* name, const char* title); //ctor
   AliCFCutBase(const AliCFCutBase& obj); //copy ctor  
   virtual ~AliCFCutBase() {;} //dtor
+  using AliAnalysisCuts::IsSelected;
+  virtual Int_t IsSelected(Int_t n, TObject** objects, Bool_t* mask); //selection of an array of objects
   virtual Bool_t IsQAOn() const {return fIsQAOn;}; //QA flag getter
   virtual void SetQAOn(TList* list) {fIsQAOn=kTRUE; AddQAHistograms(list);} //QA flag setter
   virtual void  SetMCEventInfo(const TObject *) {} //Pass pointer to MC event
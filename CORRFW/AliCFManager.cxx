@@ -34,7 +34,13 @@ AliCFManager::AliCFManager() :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fEvtCompiledCuts(),
+  fEvtCompiledNCuts(),
+  fEvtCompiledSel(),
+  fPartCompiledCuts(),
+  fPartCompiledNCuts(),
+  fPartCompiledSel()
 { 
   //
   // ctor
@@ -48,7 +54,13 @@ AliCFManager::AliCFManager(const Char_t* name, const Char_t* title) :
   fEvtContainer(0x0),
   fPartContainer(0x0),
   fEvtCutList(0x0),
-  fPartCutList(0x0)
+  fPartCutList(0x0),
+  fEvtCompiledCuts(),
+  fEvtCompiledNCuts(),
+  fEvtCompiledSel(),
+  fPartCompiledCuts(),
+  fPartCompiledNCuts(),
+  fPartCompiledSel()
 { 
    //
    // ctor
@@ -62,7 +74,13 @@ AliCFManager::AliCFManager(const AliCFManager& c) :
   fEvtContainer(c.fEvtContainer),
   fPartContainer(c.fPartContainer),
   fEvtCutList(c.fEvtCutList),
-  fPartCutList(c.fPartCutList)
+  fPartCutList(c.fPartCutList),
+  fEvtCompiledCuts(),
+  fEvtCompiledNCuts(),
+  fEvtCompiledSel(),
+  fPartCompiledCuts(),
+  fPartCompiledNCuts(),
+  fPartCompiledSel()
 { 
    //
    //copy ctor
@@ -84,6 +102,9 @@ AliCFManager& AliCFManager::operator=(const AliCFManager& c)
   this->fPartContainer=c.fPartContainer;
   this->fEvtCutList=c.fEvtCutList;
   this->fPartCutList=c.fPartCutList;
+  //compiled cuts are resolved again at the next check
+  this->fEvtCompiledNCuts.Set(0);
+  this->fPartCompiledNCuts.Set(0);
   return *this ;
 }
 
@@ -92,6 +113,8 @@ AliCFManager::~AliCFManager() {
    //
    //dtor
    //
+   fEvtCompiledCuts.Delete();
+   fPartCompiledCuts.Delete();
 }
 
 //_____________________________________________________________________________
@@ -105,16 +128,36 @@ Bool_t AliCFManager::CheckParticleCuts(Int_t isel, TObject *obj, const TString
     return kTRUE;
   }
   if(!fPartCutList[isel])return kTRUE;
-  TObjArrayIter iter(fPartCutList[isel]);
-  AliCFCutBase *cut = 0;
-  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
+  const TObjArray *cuts = GetCompiledCuts(fPartCutList,fNStepPart,isel,selcuts,fPartCompiledCuts,fPartCompiledNCuts,fPartCompiledSel);
+  for (Int_t icut=0; icut<cuts->GetEntriesFast(); icut++) {
+    if(!((AliCFCutBase*)cuts->UncheckedAt(icut))->IsSelected(obj)) return kFALSE;
   }
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+Int_t AliCFManager::CheckParticleCuts(Int_t isel, Int_t n, TObject **objects, Bool_t *mask, const TString  &selcuts) const {
+  //
+  // check which of the n objects pass particle-level selection isel
+  // (only those with mask[i] set), the cuts are applied one after the
+  // other to the whole array
+  //
+
+  Int_t nSelected = 0;
+  for (Int_t i=0; i<n; i++) if (mask[i]) nSelected++;
+
+  if(isel>=fNStepPart){
+    AliWarning(Form("Selection index out of Range! isel=%i, max. number of selections= %i", isel,fNStepPart));
+    return nSelected;
+  }
+  if(!fPartCutList[isel])return nSelected;
+  const TObjArray *cuts = GetCompiledCuts(fPartCutList,fNStepPart,isel,selcuts,fPartCompiledCuts,fPartCompiledNCuts,fPartCompiledSel);
+  for (Int_t icut=0; icut<cuts->GetEntriesFast() && nSelected>0; icut++) {
+    nSelected = ((AliCFCutBase*)cuts->UncheckedAt(icut))->IsSelected(n,objects,mask);
+  }
+  return nSelected;
+}
+
 //_____________________________________________________________________________
 Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &selcuts) const{
   //
@@ -126,16 +169,68 @@ Bool_t AliCFManager::CheckEventCuts(Int_t isel, TObject *obj, const TString  &se
       return kTRUE;
   }
   if(!fEvtCutList[isel])return kTRUE;
-  TObjArrayIter iter(fEvtCutList[isel]);
-  AliCFCutBase *cut = 0;
-  while ( (cut = (AliCFCutBase*)iter.Next()) ) {
-    TString cutName=cut->GetName();
-    Bool_t checkCut=CompareStrings(cutName,selcuts);
-    if(checkCut && !cut->IsSelected(obj)) return kFALSE;   
+  const TObjArray *cuts = GetCompiledCuts(fEvtCutList,fNStepEvt,isel,selcuts,fEvtCompiledCuts,fEvtCompiledNCuts,fEvtCompiledSel);
+  for (Int_t icut=0; icut<cuts->GetEntriesFast(); icut++) {
+    if(!((AliCFCutBase*)cuts->UncheckedAt(icut))->IsSelected(obj)) return kFALSE;
   }
   return kTRUE;
 }
 
+//_____________________________________________________________________________
+void AliCFManager::CompileEventCuts(const TString &selcuts) const {
+  //
+  // resolve the event-level cuts matching selcuts for each step
+  //
+  CompileCuts(fEvtCutList,fNStepEvt,selcuts,fEvtCompiledCuts,fEvtCompiledNCuts,fEvtCompiledSel);
+}
+
+//_____________________________________________________________________________
+void AliCFManager::CompileParticleCuts(const TString &selcuts) const {
+  //
+  // resolve the particle-level cuts matching selcuts for each step
+  //
+  CompileCuts(fPartCutList,fNStepPart,selcuts,fPartCompiledCuts,fPartCompiledNCuts,fPartCompiledSel);
+}
+
+//_____________________________________________________________________________
+void AliCFManager::CompileCuts(TObjArray **cutList, Int_t nstep, const TString &selcuts, TObjArray &compiled, TArrayI &ncuts, TString &compiledSel) const {
+  //
+  // store, for each step, the array of the cuts whose name matches selcuts
+  // (non-owning), and the size of the cut list it was built from
+  //
+
+  compiled.Delete();
+  compiled.Expand(nstep);
+  ncuts.Set(nstep);
+  for(Int_t isel=0;isel<nstep; isel++){
+    ncuts[isel] = -1;
+    if(!cutList || !cutList[isel])continue;
+    TObjArray *cuts = new TObjArray(cutList[isel]->GetEntriesFast());
+    TObjArrayIter iter(cutList[isel]);
+    AliCFCutBase *cut = 0;
+    while ( (cut = (AliCFCutBase*)iter.Next()) ) {
+      TString cutName=cut->GetName();
+      if(CompareStrings(cutName,selcuts)) cuts->Add(cut);
+    }
+    compiled.AddAt(cuts,isel);
+    ncuts[isel] = cutList[isel]->GetEntriesFast();
+  }
+  compiledSel = selcuts;
+}
+
+//_____________________________________________________________________________
+const TObjArray* AliCFManager::GetCompiledCuts(TObjArray **cutList, Int_t nstep, Int_t isel, const TString &selcuts, TObjArray &compiled, TArrayI &ncuts, TString &compiledSel) const {
+  //
+  // cuts to be checked at step isel (cutList[isel] must exist), compiled
+  // again if selcuts or the cut lists changed
+  //
+
+  if(ncuts.GetSize() != nstep || ncuts[isel] != cutList[isel]->GetEntriesFast() || compiledSel != selcuts){
+    CompileCuts(cutList,nstep,selcuts,compiled,ncuts,compiledSel);
+  }
+  return (const TObjArray*)compiled.UncheckedAt(isel);
+}
+
 //_____________________________________________________________________________
 void  AliCFManager::SetMCEventInfo(const TObject *obj) const {
 
@@ -243,6 +338,7 @@ void AliCFManager::SetEventCutsList(Int_t isel, TObjArray* array) {
     return;
   }
   fEvtCutList[isel] = array;
+  fEvtCompiledNCuts.Set(0);
 }
 
 //_____________________________________________________________________________
@@ -267,4 +363,5 @@ void AliCFManager::SetParticleCutsList(Int_t isel, TObjArray* array) {
     return;
   }
   fPartCutList[isel] = array;
+  fPartCompiledNCuts.Set(0);
 }
@@ -25,6 +25,9 @@
 //
 
 #include "TNamed.h"
+#include "TObjArray.h"
+#include "TArrayI.h"
+#include "TString.h"
 #include "AliCFContainer.h"
 #include "AliLog.h"
 
@@ -116,6 +119,17 @@ class AliCFManager : public TNamed
   virtual Bool_t CheckEventCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
   virtual Bool_t CheckParticleCuts(Int_t isel, TObject *obj, const TString &selcuts="all") const;
 
+  //Particle-level selection of an array of n objects: only the objects with
+  //mask[i] set are checked, mask[i] is reset for those failing the cuts.
+  //Returns the number of selected objects
+  virtual Int_t CheckParticleCuts(Int_t isel, Int_t n, TObject **objects, Bool_t *mask, const TString &selcuts="all") const;
+
+  //The cuts of each step matching selcuts are resolved once and kept until
+  //selcuts or the cut lists change. This is done automatically by the
+  //checkers, but can be called beforehand (e.g. in UserCreateOutputObjects)
+  virtual void CompileEventCuts(const TString &selcuts="all") const;
+  virtual void CompileParticleCuts(const TString &selcuts="all") const;
+
  private:
   
   //number of steps
@@ -130,9 +144,19 @@ class AliCFManager : public TNamed
   //Particle-level selections
   TObjArray **fPartCutList ; //[fNStepPart] arrays of cuts for each particle-selection level
 
+  //Cuts of each step matching the selection string, resolved once
+  mutable TObjArray fEvtCompiledCuts;    //! arrays of the event-level cuts to be checked for each step
+  mutable TArrayI   fEvtCompiledNCuts;   //! size of the event-level cut lists at compilation
+  mutable TString   fEvtCompiledSel;     //! selection string of the event-level compiled cuts
+  mutable TObjArray fPartCompiledCuts;   //! arrays of the particle-level cuts to be checked for each step
+  mutable TArrayI   fPartCompiledNCuts;  //! size of the particle-level cut lists at compilation
+  mutable TString   fPartCompiledSel;    //! selection string of the particle-level compiled cuts
+
   Bool_t CompareStrings(const TString  &cutname,const TString  &selcuts) const;
+  void CompileCuts(TObjArray **cutList, Int_t nstep, const TString &selcuts, TObjArray &compiled, TArrayI &ncuts, TString &compiledSel) const;
+  const TObjArray* GetCompiledCuts(TObjArray **cutList, Int_t nstep, Int_t isel, const TString &selcuts, TObjArray &compiled, TArrayI &ncuts, TString &compiledSel) const;
 
-  ClassDef(AliCFManager,2);
+  ClassDef(AliCFManager,3);
 };
 
 
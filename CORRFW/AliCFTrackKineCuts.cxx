@@ -431,6 +431,47 @@ Bool_t AliCFTrackKineCuts::IsSelected(TObject* obj) {
   return kTRUE;
 }
 //__________________________________________________________________________________
+Int_t AliCFTrackKineCuts::IsSelected(Int_t n, TObject** objects, Bool_t* mask) {
+  //
+  // selection of an array of tracks, same decisions as IsSelected(TObject*):
+  // the single cuts are evaluated directly (stopping at the first failing
+  // one) instead of filling the bitmap, and the inheritance from
+  // AliVParticle is only looked up once per class.
+  // With QA on, the tracks are checked one by one to fill the histograms.
+  //
+  if (fIsQAOn) return AliCFCutBase::IsSelected(n,objects,mask);
+
+  Int_t nSelected = 0;
+  TClass* lastClass = 0x0;
+  Bool_t isVParticle = kFALSE;
+  for (Int_t i=0; i<n; i++) {
+    if (!mask[i]) continue;
+    TObject* obj = objects[i];
+    AliVParticle* particle = 0x0;
+    if (obj) {
+      if (obj->IsA() != lastClass) {
+	lastClass = obj->IsA();
+	isVParticle = obj->InheritsFrom("AliVParticle");
+      }
+      if (!isVParticle) AliError("object must derived from AliVParticle !");
+      particle = dynamic_cast<AliVParticle *>(obj);
+    }
+    mask[i] = particle &&
+      (particle->P() >= fMomentumMin) && (particle->P() <= fMomentumMax) &&
+      (particle->Pt() >= fPtMin) && (particle->Pt() <= fPtMax) &&
+      (particle->Px() >= fPxMin) && (particle->Px() <= fPxMax) &&
+      (particle->Py() >= fPyMin) && (particle->Py() <= fPyMax) &&
+      (particle->Pz() >= fPzMin) && (particle->Pz() <= fPzMax) &&
+      (particle->Eta() >= fEtaMin) && (particle->Eta() <= fEtaMax) &&
+      (particle->Y() >= fRapidityMin) && (particle->Y() <= fRapidityMax) &&
+      (particle->Phi() >= fPhiMin) && (particle->Phi() <= fPhiMax) &&
+      (fCharge >= 10 || (particle->Charge() == fCharge)) &&
+      (!fRequireIsCharged || particle->Charge()!=0);
+    if (mask[i]) nSelected++;
+  }
+  return nSelected;
+}
+//__________________________________________________________________________________
 void AliCFTrackKineCuts::SetHistogramBins(Int_t index, Int_t nbins, Double_t *bins)
 {
   //
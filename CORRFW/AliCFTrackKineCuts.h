@@ -65,6 +65,7 @@ class AliCFTrackKineCuts : public AliCFCutBase
 
   Bool_t IsSelected(TObject* obj);
   Bool_t IsSelected(TList* /*list*/) {return kTRUE;}
+  Int_t  IsSelected(Int_t n, TObject** objects, Bool_t* mask);
 
   // cut value setter
   void SetMomentumRange(Double_t momentumMin=0., Double_t momentumMax=1e99) {fMomentumMin=momentumMin; fMomentumMax=momentumMax;}
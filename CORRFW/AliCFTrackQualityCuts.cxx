@@ -425,6 +425,27 @@ void AliCFTrackQualityCuts::SelectionBitMap(TObject* obj)
   // test if the track passes the single cuts
   // and store the information in a bitmap
   //
+  SetTrackCutsParameters();
+  FillBitMap(obj);
+}
+//__________________________________________________________________________________
+void AliCFTrackQualityCuts::SetTrackCutsParameters()
+{
+  //
+  // pass the cut values to the AliESDtrackCuts
+  //
+  fTrackCuts->SetMinNClustersTPC(fMinNClusterTPC);
+  fTrackCuts->SetMinNClustersITS(fMinNClusterITS);
+  fTrackCuts->SetMaxChi2PerClusterTPC(fMaxChi2PerClusterTPC);
+  fTrackCuts->SetMaxChi2PerClusterITS(fMaxChi2PerClusterITS);
+  fTrackCuts->SetMaxCovDiagonalElements(fCovariance11Max,fCovariance22Max,fCovariance33Max,fCovariance44Max,fCovariance55Max);
+}
+//__________________________________________________________________________________
+void AliCFTrackQualityCuts::FillBitMap(TObject* obj)
+{
+  //
+  // fill the bitmap with the decision of each single cut
+  //
 
   // bitmap stores the decision of each single cut
   for(Int_t i=0; i<kNCuts; i++)fBitmap->SetBitNumber(i,kFALSE);
@@ -449,12 +470,6 @@ void AliCFTrackQualityCuts::SelectionBitMap(TObject* obj)
   if (esdTrack) isESDTrack = strcmp(obj->ClassName(),"AliESDtrack") == 0 ? kTRUE : kFALSE ;
   if (aodTrack) isAODTrack = strcmp(obj->ClassName(),"AliAODTrack") == 0 ? kTRUE : kFALSE ;
 
-  fTrackCuts->SetMinNClustersTPC(fMinNClusterTPC);
-  fTrackCuts->SetMinNClustersITS(fMinNClusterITS);
-  fTrackCuts->SetMaxChi2PerClusterTPC(fMaxChi2PerClusterTPC);
-  fTrackCuts->SetMaxChi2PerClusterITS(fMaxChi2PerClusterITS);
-  fTrackCuts->SetMaxCovDiagonalElements(fCovariance11Max,fCovariance22Max,fCovariance33Max,fCovariance44Max,fCovariance55Max);
-
 // // // remove following 5 lines when AliESDtrackCuts is updated
    Int_t    nClustersTPC = 0;
    Int_t    nClustersITS = 0 ;
@@ -584,6 +599,25 @@ Bool_t AliCFTrackQualityCuts::IsSelected(TObject* obj) {
   return kTRUE;
 }
 //__________________________________________________________________________________
+Int_t AliCFTrackQualityCuts::IsSelected(Int_t n, TObject** objects, Bool_t* mask) {
+  //
+  // selection of an array of tracks, same decisions as IsSelected(TObject*):
+  // the cut values are passed to fTrackCuts once for the whole array.
+  // With QA on, the tracks are checked one by one to fill the histograms.
+  //
+  if (fIsQAOn) return AliCFCutBase::IsSelected(n,objects,mask);
+
+  SetTrackCutsParameters();
+  Int_t nSelected = 0;
+  for (Int_t i=0; i<n; i++) {
+    if (!mask[i]) continue;
+    FillBitMap(objects[i]);
+    mask[i] = fBitmap->CountBits() == fBitmap->GetNbits();
+    if (mask[i]) nSelected++;
+  }
+  return nSelected;
+}
+//__________________________________________________________________________________
 void AliCFTrackQualityCuts::SetHistogramBins(Int_t index, Int_t nbins, Double_t *bins)
 {
   //
@@ -67,6 +67,7 @@ class AliCFTrackQualityCuts : public AliCFCutBase
 
   Bool_t IsSelected(TObject* obj);
   Bool_t IsSelected(TList* /*list*/) {return kTRUE;}
+  Int_t  IsSelected(Int_t n, TObject** objects, Bool_t* mask);
 
   // cut value setter
   void SetMinNClusterTPC(Int_t cluster=-1)		{fMinNClusterTPC = cluster;}
@@ -117,6 +118,8 @@ class AliCFTrackQualityCuts : public AliCFCutBase
 
  private:
   void SelectionBitMap(TObject* obj);
+  void SetTrackCutsParameters();	// passes the cut values to fTrackCuts
+  void FillBitMap(TObject* obj);	// stores the single selection decisions in fBitmap
   void DefineHistograms(); 		// books histograms and TList
   void Initialise();			// sets everything to 0
   void FillHistograms(TObject* obj, Bool_t b);
@@ -9,6 +9,7 @@
 //
 
 #include <TEntryList.h>
+#include <TMath.h>
 
 #include "AliLog.h"
 #include "AliMixEventCutObj.h"
@@ -23,7 +24,12 @@ AliMixEventPool::AliMixEventPool(const char *name, const char *title) : TNamed(n
    fListOfEventCuts(),
    fBinNumber(0),
    fBufferSize(0),
-   fMixNumber(0)
+   fMixNumber(0),
+   fUseRingBuffer(kFALSE),
+   fRingDepth(0),
+   fCutStrides(),
+   fRingEntries(),
+   fRingCounts()
 {
    //
    // Default constructor.
@@ -37,7 +43,12 @@ AliMixEventPool::AliMixEventPool(const AliMixEventPool &obj) : TNamed(obj),
    fListOfEventCuts(obj.fListOfEventCuts),
    fBinNumber(obj.fBinNumber),
    fBufferSize(obj.fBufferSize),
-   fMixNumber(obj.fMixNumber)
+   fMixNumber(obj.fMixNumber),
+   fUseRingBuffer(obj.fUseRingBuffer),
+   fRingDepth(obj.fRingDepth),
+   fCutStrides(obj.fCutStrides),
+   fRingEntries(obj.fRingEntries),
+   fRingCounts(obj.fRingCounts)
 {
    //
    // Copy constructor
@@ -59,6 +70,11 @@ AliMixEventPool &AliMixEventPool::operator=(const AliMixEventPool &obj)
       fBinNumber = obj.fBinNumber;
       fBufferSize = obj.fBufferSize;
       fMixNumber = obj.fMixNumber;
+      fUseRingBuffer = obj.fUseRingBuffer;
+      fRingDepth = obj.fRingDepth;
+      fCutStrides = obj.fCutStrides;
+      fRingEntries = obj.fRingEntries;
+      fRingCounts = obj.fRingCounts;
    }
    return *this;
 }
@@ -111,10 +127,35 @@ Int_t AliMixEventPool::Init()
    fBinNumber++;
    AliDebug(AliLog::kDebug, Form("fBinnumber = %d", fBinNumber));
    AddEntryList();
+   if (fUseRingBuffer) InitRingBuffer();
    AliDebug(AliLog::kDebug + 5, "->");
    return 0;
 }
 
+//_________________________________________________________________________________________________
+void AliMixEventPool::InitRingBuffer()
+{
+   //
+   // Precomputes bin strides of all cuts and allocates
+   // ring buffer with fRingDepth entries for every bin
+   //
+   Int_t num = fListOfEventCuts.GetEntriesFast();
+   fCutStrides.Set(num);
+   Int_t stride = 1;
+   AliMixEventCutObj *cut;
+   for (Int_t i = 0; i < num; i++) {
+      cut = (AliMixEventCutObj *) fListOfEventCuts.UncheckedAt(i);
+      fCutStrides[i] = stride;
+      stride *= cut->GetNumberOfBins();
+   }
+   if (fRingDepth <= 0) fRingDepth = TMath::Max(fBufferSize, 2 * fMixNumber + 1) + 1;
+   fRingEntries.Set(fBinNumber * fRingDepth);
+   fRingEntries.Reset(-1);
+   fRingCounts.Set(fBinNumber);
+   fRingCounts.Reset();
+   AliDebug(AliLog::kDebug, Form("Ring buffer: bins=%d depth=%d", fBinNumber, fRingDepth));
+}
+
 //_________________________________________________________________________________________________
 void AliMixEventPool::CreateEntryListsRecursivly(Int_t index)
 {
@@ -173,6 +214,7 @@ Bool_t AliMixEventPool::AddEntry(Long64_t entry, AliVEvent *ev)
       AliDebug(AliLog::kDebug, Form("Entry %lld was NOT added !!!", entry));
       return kFALSE;
    }
+   if (fUseRingBuffer) return AddEntryToBin(entry, FindBinIndex(ev));
    Int_t idEntryList = -1;
    TEntryList *el =  FindEntryList(ev, idEntryList);
    if (el) {
@@ -237,6 +279,64 @@ void AliMixEventPool::SearchIndexRecursive(Int_t num, Int_t *i, Int_t *d, Int_t
    AliDebug(AliLog::kDebug + 5, "->");
 }
 
+//_________________________________________________________________________________________________
+Int_t AliMixEventPool::FindBinIndex(AliVEvent *ev)
+{
+   //
+   // Finds flat bin index (starting from 0) of event using strides
+   // precomputed in Init(). Returns -1 when event is out of range
+   //
+   Int_t num = fCutStrides.GetSize();
+   if (num < 1) return -1;
+   Int_t binIndex = 0, index;
+   for (Int_t i = 0; i < num; i++) {
+      index = ((AliMixEventCutObj *) fListOfEventCuts.UncheckedAt(i))->GetIndex(ev);
+      if (index < 0) return -1;
+      binIndex += (index - 1) * fCutStrides.fArray[i];
+   }
+   AliDebug(AliLog::kDebug, Form("binIndex %d", binIndex));
+   return binIndex;
+}
+
+//_________________________________________________________________________________________________
+Bool_t AliMixEventPool::AddEntryToBin(Long64_t entry, Int_t binIndex)
+{
+   //
+   // Adds entry to ring buffer of bin (oldest entry is overwritten)
+   //
+   if (entry < 0 || binIndex < 0 || binIndex >= fRingCounts.GetSize()) {
+      AliDebug(AliLog::kDebug, Form("Entry %lld was NOT added !!!", entry));
+      return kFALSE;
+   }
+   Long64_t &n = fRingCounts.fArray[binIndex];
+   fRingEntries.fArray[binIndex * fRingDepth + n % fRingDepth] = entry;
+   n++;
+   AliDebug(AliLog::kDebug, Form("Entry %lld was added to bin %d !!!", entry, binIndex));
+   return kTRUE;
+}
+
+//_________________________________________________________________________________________________
+Long64_t AliMixEventPool::GetNEntriesInBin(Int_t binIndex) const
+{
+   //
+   // Returns number of entries added to bin so far
+   //
+   if (binIndex < 0 || binIndex >= fRingCounts.GetSize()) return 0;
+   return fRingCounts.fArray[binIndex];
+}
+
+//_________________________________________________________________________________________________
+Long64_t AliMixEventPool::GetEntryInBin(Int_t binIndex, Long64_t index) const
+{
+   //
+   // Returns entry number of index-th entry added to bin (same numbering as TEntryList::GetEntry).
+   // Returns -1 if entry was already dropped from ring buffer
+   //
+   Long64_t n = GetNEntriesInBin(binIndex);
+   if (index < 0 || index >= n || index < n - fRingDepth) return -1;
+   return fRingEntries.fArray[binIndex * fRingDepth + index % fRingDepth];
+}
+
 //_________________________________________________________________________________________________
 Bool_t AliMixEventPool::SetCutValuesFromBinIndex(Int_t index)
 {
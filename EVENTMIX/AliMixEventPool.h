@@ -13,6 +13,8 @@
 
 #include <TObjArray.h>
 #include <TNamed.h>
+#include <TArrayI.h>
+#include <TArrayL64.h>
 
 class TEntryList;
 class AliMixEventCutObj;
@@ -39,6 +41,13 @@ public:
 
    void        AddCut(AliMixEventCutObj *cut);
 
+   // ring buffer pool mode (fixed depth of entries per bin)
+   Int_t       FindBinIndex(AliVEvent *ev);
+   Bool_t      AddEntryToBin(Long64_t entry, Int_t binIndex);
+   Long64_t    GetNEntriesInBin(Int_t binIndex) const;
+   Long64_t    GetEntryInBin(Int_t binIndex, Long64_t index) const;
+   Int_t       GetNumberOfBins() const { return fBinNumber; }
+
    Bool_t      NeedInit() { return (fListOfEntryList.GetEntries() == 0); }
    TObjArray  *GetListOfEntryLists() { return &fListOfEntryList; }
    TObjArray  *GetListOfEventCuts() { return &fListOfEventCuts; }
@@ -48,6 +57,10 @@ public:
    void        SetMixNumber(Int_t numMix) { fMixNumber = numMix; }
    Int_t       GetBufferSize() const { return fBufferSize; }
    Int_t       GetMixNumber() const { return fMixNumber; }
+   void        SetUseRingBuffer(Bool_t b = kTRUE, Int_t depth = 0) { fUseRingBuffer = b; fRingDepth = depth; }
+   void        SetRingBufferDepth(Int_t depth) { fRingDepth = depth; }
+   Bool_t      UseRingBuffer() const { return fUseRingBuffer; }
+   Int_t       GetRingBufferDepth() const { return fRingDepth; }
 
 private:
 
@@ -58,7 +71,15 @@ private:
    Int_t       fBufferSize;            // buffer size
    Int_t       fMixNumber;             // mixing number
 
-   ClassDef(AliMixEventPool, 1)
+   Bool_t      fUseRingBuffer;         // use fixed depth ring buffer per bin instead of TEntryList
+   Int_t       fRingDepth;             // depth of ring buffer per bin
+   TArrayI     fCutStrides;            //! stride of each cut in flat bin index
+   TArrayL64   fRingEntries;           //! ring buffer storage (fBinNumber x fRingDepth)
+   TArrayL64   fRingCounts;            //! number of entries added per bin
+
+   void        InitRingBuffer();
+
+   ClassDef(AliMixEventPool, 2)
 };
 
 #endif
@@ -11,6 +11,7 @@
 #include <TChain.h>
 #include <TChainElement.h>
 #include <TSystem.h>
+#include <TMath.h>
 
 #include "AliLog.h"
 #include "AliAnalysisManager.h"
@@ -158,8 +159,11 @@ Bool_t AliMixInputEventHandler::Notify(const char *path)
       fMixTrees.Add(mixIHI);
    }
    AliDebug(AliLog::kDebug + 5, Form("fEntryCounter=%lld", fEntryCounter));
-   if (fEventPool && fEventPool->NeedInit())
+   if (fEventPool && fEventPool->NeedInit()) {
+      if (fEventPool->UseRingBuffer() && fEventPool->GetRingBufferDepth() <= 0)
+         fEventPool->SetRingBufferDepth(TMath::Max(fBufferSize, 2 * fMixNumber + 1) + 1);
       fEventPool->Init();
+   }
    if (fUseDefautProcess) {
       AliDebug(AliLog::kDebug, Form("-> SKIPPED"));
       return AliMultiInputEventHandler::Notify(path);
@@ -298,7 +302,6 @@ Bool_t AliMixInputEventHandler::MixBuffer()
    // fill entry
    Long64_t currentMainEntry = inEvHMain->GetTree()->GetTree()->GetReadEntry() + zeroChainEntries;
    // fills entry
-   if (fEventPool && inEvHMain) fEventPool->AddEntry(currentMainEntry, inEvHMain->GetEvent());
    // start of
    AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ BEGIN SETUP EVENT %lld +++++++++++++++++++", fEntryCounter));
    // reset mix number
@@ -306,21 +309,32 @@ Bool_t AliMixInputEventHandler::MixBuffer()
    Long64_t elNum = 0;
    TEntryList *el = 0;
    Int_t idEntryList = -1;
-   if (fEventPool) el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
+   Int_t binIndex = -1;
+   Bool_t useRing = (fEventPool && fEventPool->UseRingBuffer());
+   if (useRing) {
+      // bin is found only once and entry goes directly to its ring buffer
+      binIndex = fEventPool->FindBinIndex(inEvHMain->GetEvent());
+      fEventPool->AddEntryToBin(currentMainEntry, binIndex);
+      if (binIndex >= 0) idEntryList = binIndex + 1;
+   } else if (fEventPool) {
+      fEventPool->AddEntry(currentMainEntry, inEvHMain->GetEvent());
+      el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
+   }
+   Bool_t hasBin = (el || binIndex >= 0);
    // return in case of 0 entry in full chain
    if (!fEntryCounter) {
       AliDebug(AliLog::kDebug + 3, Form("-> fEntryCounter == 0"));
       // runs UserExecMix for all tasks, if needed
-      if (el) UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, -1, 0);
+      if (hasBin) UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, -1, 0);
       else UserExecMixAllTasks(fEntryCounter, -1, currentMainEntry, -1, 0);
       return kTRUE;
    }
-   if (!el) {
+   if (!hasBin) {
       AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld SKIPPED (el null) +++++++++++++++++++", fEntryCounter));
       UserExecMixAllTasks(fEntryCounter, -1, fEntryCounter, -1, 0);
       return kTRUE;
    } else {
-      elNum = el->GetN();
+      elNum = useRing ? fEventPool->GetNEntriesInBin(binIndex) : el->GetN();
       if (elNum < fBufferSize + 1) {
          UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, -1, 0);
          AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld SKIPPED (%lld) LESS THEN BUFFER +++++++++++++++++++", fEntryCounter, elNum));
@@ -339,7 +353,7 @@ Bool_t AliMixInputEventHandler::MixBuffer()
          if (elNum >= fBufferSize) {
             Long64_t entryInEntryList =  elNum - 2 - counter;
             if (entryInEntryList < 0) break;
-            entryMix = el->GetEntry(entryInEntryList);
+            entryMix = useRing ? fEventPool->GetEntryInBin(binIndex, entryInEntryList) : el->GetEntry(entryInEntryList);
          }
       }
       AliDebug(AliLog::kDebug + 5, Form("Handler[%d] entryMix %lld ", counter, entryMix));
@@ -398,7 +412,6 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
    Long64_t zeroChainEntries = fMixIntupHandlerInfoTmp->GetChain()->GetEntries() - inEvHMain->GetTree()->GetTree()->GetEntries();
    // fill entry
    Long64_t currentMainEntry = inEvHMain->GetTree()->GetTree()->GetReadEntry() + zeroChainEntries;
-   if (fEventPool && inEvHMain) fEventPool->AddEntry(currentMainEntry, inEvHMain->GetEvent());
    // start of
    AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ BEGIN SETUP EVENT %lld +++++++++++++++++++", fEntryCounter));
    // reset mix number
@@ -406,11 +419,21 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
    Long64_t elNum = 0;
    Int_t idEntryList = -1;
    TEntryList *el = 0;
-   if (fEventPool) el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
+   Int_t binIndex = -1;
+   Bool_t useRing = (fEventPool && fEventPool->UseRingBuffer());
+   if (useRing) {
+      binIndex = fEventPool->FindBinIndex(inEvHMain->GetEvent());
+      fEventPool->AddEntryToBin(currentMainEntry, binIndex);
+      if (binIndex >= 0) idEntryList = binIndex + 1;
+   } else if (fEventPool) {
+      fEventPool->AddEntry(currentMainEntry, inEvHMain->GetEvent());
+      el = fEventPool->FindEntryList(inEvHMain->GetEvent(), idEntryList);
+   }
+   Bool_t hasBin = (el || binIndex >= 0);
    // return in case of 0 entry in full chain
    if (!fEntryCounter) {
       // runs UserExecMix for all tasks, if needed
-      if (el && fDoMixIfNotEnoughEvents) {
+      if (hasBin && fDoMixIfNotEnoughEvents) {
          UserExecMixAllTasks(fEntryCounter, idEntryList, currentMainEntry, -1, 0);
       } else {
          idEntryList = -1;
@@ -419,14 +442,14 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
       AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld SKIPPED (fEntryCounter=0, idEntryList=%d) +++++++++++++++++++", fEntryCounter, idEntryList));
       return kTRUE;
    }
-   if (!el) {
+   if (!hasBin) {
       if (fEventPool) {
          AliDebug(AliLog::kDebug + 3, Form("++++++++++++++ END SETUP EVENT %lld SKIPPED (el null, idEntryList=%d) +++++++++++++++++++", fEntryCounter, idEntryList));
          UserExecMixAllTasks(fEntryCounter, -1, currentMainEntry, -1, 0);
          return kTRUE;
       }
    } else {
-      elNum = el->GetN();
+      elNum = useRing ? fEventPool->GetNEntriesInBin(binIndex) : el->GetN();
       if (elNum < fBufferSize + 1) {
          if (fDoMixIfNotEnoughEvents) {
             // include main event in to counter in this case (so idEntryList>0)
@@ -462,7 +485,7 @@ Bool_t AliMixInputEventHandler::MixEventsMoreTimesWithOneEvent()
       Long64_t entryInEntryList =  elNum - 2 - counter;
       AliDebug(AliLog::kDebug + 3, Form("entryInEntryList=%lld", entryInEntryList));
       if (entryInEntryList < 0) break;
-      entryMix = el->GetEntry(entryInEntryList);
+      entryMix = useRing ? fEventPool->GetEntryInBin(binIndex, entryInEntryList) : el->GetEntry(entryInEntryList);
       AliDebug(AliLog::kDebug + 3, Form("entryMix=%lld", entryMix));
       if (entryMix < 0) break;
       entryMixReal = entryMix;
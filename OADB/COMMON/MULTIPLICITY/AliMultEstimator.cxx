@@ -20,18 +20,20 @@
 #include "TBrowser.h"
 #include "TFormula.h"
 #include "RVersion.h"
+#include "AliLog.h"
+#include <cctype>
 
 ClassImp(AliMultEstimator);
 //________________________________________________________________
 AliMultEstimator::AliMultEstimator() :
-  TNamed(), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
+  TNamed(), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0), fProgram(), fConstants(), fNProgram(0),
 fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 {
   // Constructor
   
 }
 AliMultEstimator::AliMultEstimator(const char * name, const char * title, TString lInitDef):
-TNamed(name,title), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0),
+TNamed(name,title), fDefinition(""), fIsInteger(kFALSE), fValue(0), fMean(0), fPercentile(0), fFormula(0), fProgram(), fConstants(), fNProgram(0),
 fkUseAnchor(kFALSE), fAnchorPoint(0), fAnchorPercentile(100.0)
 {
     //Named, titled, definition constructor
@@ -46,6 +48,9 @@ fValue(e.fValue),
 fMean(e.fMean),
 fPercentile(e.fPercentile),
 fFormula(0),
+fProgram(e.fProgram),
+fConstants(e.fConstants),
+fNProgram(e.fNProgram),
 fkUseAnchor(e.fkUseAnchor),
 fAnchorPoint(e.fAnchorPoint),
 fAnchorPercentile(e.fAnchorPercentile)
@@ -67,6 +72,9 @@ AliMultEstimator& AliMultEstimator::operator=(const AliMultEstimator& e)
     if (fFormula) delete fFormula;
     fFormula = 0;
     if (e.fFormula) fFormula = new TFormula(*e.fFormula);
+    fProgram    = e.fProgram;
+    fConstants  = e.fConstants;
+    fNProgram   = e.fNProgram;
     
     //Anchor point configs
     fkUseAnchor         = e.fkUseAnchor;
@@ -121,10 +129,15 @@ void AliMultEstimator::SetupFormula(const AliMultInput* lInput)
         lVarName.Prepend("(");
         expr.ReplaceAll(lVarName, repl);
     }
+    if (fFormula) delete fFormula;
     fFormula = new TFormula(Form("e%s", GetName()), expr);
 #if ROOT_VERSION_CODE < ROOT_VERSION(5,99,4)
     fFormula->Optimize();
 #endif
+    //Also compile to stack program if definition is simple arithmetic
+    //(anything else, e.g. functions, is left to TFormula)
+    if ( !CompileDefinition(expr) )
+        AliDebugF(1, "Estimator %s: definition not compiled, using TFormula", GetName());
 }
 //________________________________________________________________
 Float_t AliMultEstimator::Evaluate(const AliMultInput* lInput)
@@ -138,3 +151,156 @@ Float_t AliMultEstimator::Evaluate(const AliMultInput* lInput)
     }
     return fValue = fFormula->Eval(0);
 }
+//________________________________________________________________
+Float_t AliMultEstimator::Evaluate(const Double_t* lValues)
+{
+    //Evaluate the compiled definition on a flat array of variable values,
+    //in the same order as the variables in the AliMultInput used in SetupFormula
+    if (fNProgram == 0) {
+        if (!fFormula) return fValue = 0;
+        fFormula->SetParameters(lValues);
+        return fValue = fFormula->Eval(0);
+    }
+    Double_t lStack[kMaxStackDepth];
+    Int_t lTop = -1;
+    const Int_t* lProg = fProgram.GetArray();
+    for (Int_t i = 0; i < fNProgram; i++) {
+        switch (lProg[i]) {
+            case kOpConst: lStack[++lTop] = fConstants[lProg[++i]]; break;
+            case kOpVar:   lStack[++lTop] = lValues[lProg[++i]]; break;
+            case kOpAdd:   lTop--; lStack[lTop] += lStack[lTop+1]; break;
+            case kOpSub:   lTop--; lStack[lTop] -= lStack[lTop+1]; break;
+            case kOpMul:   lTop--; lStack[lTop] *= lStack[lTop+1]; break;
+            case kOpDiv:   lTop--; lStack[lTop] /= lStack[lTop+1]; break;
+            case kOpNeg:   lStack[lTop] = -lStack[lTop]; break;
+        }
+    }
+    return fValue = lStack[0];
+}
+//________________________________________________________________
+void AliMultEstimator::AddOp(Int_t lOp, Int_t lArg)
+{
+    if (fNProgram + 2 > fProgram.GetSize()) fProgram.Set(2*fProgram.GetSize() + 16);
+    fProgram[fNProgram++] = lOp;
+    if (lArg >= 0) fProgram[fNProgram++] = lArg;
+}
+//________________________________________________________________
+Bool_t AliMultEstimator::CompileDefinition(const TString& lExpr)
+{
+    //Compile expression (variables already replaced by [i]) to a stack
+    //program. Supported: numbers, [i], + - * / and parentheses.
+    fProgram.Set(0);
+    fConstants.Set(0);
+    fNProgram = 0;
+    
+    Int_t lPos = 0, lDepth = 0;
+    Bool_t lIsIntConst = kFALSE;
+    Bool_t lOk = CompileSum(lExpr, lPos, lDepth, lIsIntConst);
+    while (lOk && lPos < lExpr.Length() && isspace(lExpr[lPos])) lPos++;
+    if (!lOk || lPos != lExpr.Length() || fNProgram == 0) {
+        fProgram.Set(0);
+        fConstants.Set(0);
+        fNProgram = 0;
+        return kFALSE;
+    }
+    return kTRUE;
+}
+//________________________________________________________________
+Bool_t AliMultEstimator::CompileSum(const TString& lExpr, Int_t& lPos, Int_t& lDepth, Bool_t& lIsIntConst)
+{
+    if (!CompileProduct(lExpr, lPos, lDepth, lIsIntConst)) return kFALSE;
+    while (kTRUE) {
+        while (lPos < lExpr.Length() && isspace(lExpr[lPos])) lPos++;
+        if (lPos >= lExpr.Length() || (lExpr[lPos] != '+' && lExpr[lPos] != '-')) return kTRUE;
+        Int_t lOp = (lExpr[lPos++] == '+') ? kOpAdd : kOpSub;
+        Bool_t lRightIsIntConst = kFALSE;
+        if (!CompileProduct(lExpr, lPos, lDepth, lRightIsIntConst)) return kFALSE;
+        AddOp(lOp);
+        lDepth--;
+        lIsIntConst = kFALSE;
+    }
+}
+//________________________________________________________________
+Bool_t AliMultEstimator::CompileProduct(const TString& lExpr, Int_t& lPos, Int_t& lDepth, Bool_t& lIsIntConst)
+{
+    if (!CompileUnary(lExpr, lPos, lDepth, lIsIntConst)) return kFALSE;
+    while (kTRUE) {
+        while (lPos < lExpr.Length() && isspace(lExpr[lPos])) lPos++;
+        if (lPos >= lExpr.Length() || (lExpr[lPos] != '*' && lExpr[lPos] != '/')) return kTRUE;
+        //'**' is a power in TFormula: not supported here
+        if (lExpr[lPos] == '*' && lPos+1 < lExpr.Length() && lExpr[lPos+1] == '*') return kFALSE;
+        Int_t lOp = (lExpr[lPos++] == '*') ? kOpMul : kOpDiv;
+        Bool_t lRightIsIntConst = kFALSE;
+        if (!CompileUnary(lExpr, lPos, lDepth, lRightIsIntConst)) return kFALSE;
+        //Integer literal division may be integer division in TFormula: leave it to TFormula
+        if (lOp == kOpDiv && lIsIntConst && lRightIsIntConst) return kFALSE;
+        AddOp(lOp);
+        lDepth--;
+        lIsIntConst = kFALSE;
+    }
+}
+//________________________________________________________________
+Bool_t AliMultEstimator::CompileUnary(const TString& lExpr, Int_t& lPos, Int_t& lDepth, Bool_t& lIsIntConst)
+{
+    while (lPos < lExpr.Length() && isspace(lExpr[lPos])) lPos++;
+    if (lPos < lExpr.Length() && (lExpr[lPos] == '-' || lExpr[lPos] == '+')) {
+        Bool_t lNegate = (lExpr[lPos++] == '-');
+        if (!CompileUnary(lExpr, lPos, lDepth, lIsIntConst)) return kFALSE;
+        if (lNegate) AddOp(kOpNeg);
+        return kTRUE;
+    }
+    return CompilePrimary(lExpr, lPos, lDepth, lIsIntConst);
+}
+//________________________________________________________________
+Bool_t AliMultEstimator::CompilePrimary(const TString& lExpr, Int_t& lPos, Int_t& lDepth, Bool_t& lIsIntConst)
+{
+    while (lPos < lExpr.Length() && isspace(lExpr[lPos])) lPos++;
+    if (lPos >= lExpr.Length()) return kFALSE;
+    lIsIntConst = kFALSE;
+    
+    const Char_t c = lExpr[lPos];
+    if (c == '(') {
+        lPos++;
+        if (!CompileSum(lExpr, lPos, lDepth, lIsIntConst)) return kFALSE;
+        while (lPos < lExpr.Length() && isspace(lExpr[lPos])) lPos++;
+        if (lPos >= lExpr.Length() || lExpr[lPos] != ')') return kFALSE;
+        lPos++;
+        return kTRUE;
+    }
+    if (c == '[') {
+        Int_t lStart = ++lPos;
+        while (lPos < lExpr.Length() && isdigit(lExpr[lPos])) lPos++;
+        if (lPos == lStart || lPos >= lExpr.Length() || lExpr[lPos] != ']') return kFALSE;
+        Int_t lVarIndex = TString(lExpr(lStart, lPos-lStart)).Atoi();
+        lPos++;
+        if (++lDepth > kMaxStackDepth) return kFALSE;
+        AddOp(kOpVar, lVarIndex);
+        return kTRUE;
+    }
+    if (isdigit(c) || c == '.') {
+        Int_t lStart = lPos;
+        Bool_t lIsInt = kTRUE;
+        while (lPos < lExpr.Length() && (isdigit(lExpr[lPos]) || lExpr[lPos] == '.')) {
+            if (lExpr[lPos] == '.') lIsInt = kFALSE;
+            lPos++;
+        }
+        if (lPos < lExpr.Length() && (lExpr[lPos] == 'e' || lExpr[lPos] == 'E')) {
+            lIsInt = kFALSE;
+            lPos++;
+            if (lPos < lExpr.Length() && (lExpr[lPos] == '+' || lExpr[lPos] == '-')) lPos++;
+            if (lPos >= lExpr.Length() || !isdigit(lExpr[lPos])) return kFALSE;
+            while (lPos < lExpr.Length() && isdigit(lExpr[lPos])) lPos++;
+        }
+        TString lNumber = lExpr(lStart, lPos-lStart);
+        if (!lNumber.IsFloat()) return kFALSE;
+        if (++lDepth > kMaxStackDepth) return kFALSE;
+        Int_t lConstIndex = fConstants.GetSize();
+        fConstants.Set(lConstIndex+1);
+        fConstants[lConstIndex] = lNumber.Atof();
+        AddOp(kOpConst, lConstIndex);
+        lIsIntConst = lIsInt;
+        return kTRUE;
+    }
+    //Functions, named constants, etc: leave to TFormula
+    return kFALSE;
+}
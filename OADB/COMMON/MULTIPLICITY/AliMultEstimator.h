@@ -1,6 +1,8 @@
 #ifndef AliMultEstimator_H
 #define AliMultEstimator_H
 #include <TNamed.h>
+#include <TArrayI.h>
+#include <TArrayD.h>
 class AliMultInput;
 class TFormula;
 
@@ -43,8 +45,21 @@ public:
     //Pre-processing for speed
     void SetupFormula(const AliMultInput* lInput);
     Float_t Evaluate(const AliMultInput* lInput);
+    //Evaluate from flat array of variable values (see AliMultInput::GetValues)
+    Float_t Evaluate(const Double_t* lValues);
+    Bool_t  IsCompiled() const { return fProgram.GetSize() > 0; }
     
 private:
+    //Compilation of the definition into a small stack program
+    enum EProgramOp { kOpConst = 0, kOpVar, kOpAdd, kOpSub, kOpMul, kOpDiv, kOpNeg };
+    enum { kMaxStackDepth = 32 };
+    Bool_t CompileDefinition(const TString& lExpr);
+    Bool_t CompileSum     (const TString& lExpr, Int_t& lPos, Int_t& lDepth, Bool_t& lIsIntConst);
+    Bool_t CompileProduct (const TString& lExpr, Int_t& lPos, Int_t& lDepth, Bool_t& lIsIntConst);
+    Bool_t CompileUnary   (const TString& lExpr, Int_t& lPos, Int_t& lDepth, Bool_t& lIsIntConst);
+    Bool_t CompilePrimary (const TString& lExpr, Int_t& lPos, Int_t& lDepth, Bool_t& lIsIntConst);
+    void   AddOp(Int_t lOp, Int_t lArg = -1);
+    
     TString fDefinition; //How to evaluate based on AliMultVariables
     Bool_t fIsInteger; //Requires special treatment when calibrating
     
@@ -52,12 +67,15 @@ private:
     Float_t fMean;   // estimator mean value
     Float_t fPercentile;   //Percentile
     TFormula* fFormula; //!
+    TArrayI fProgram;   //! compiled definition (opcodes and arguments), empty if not compilable
+    TArrayD fConstants; //! constants used by the compiled definition
+    Int_t   fNProgram;  //! number of used entries in fProgram
     
     //Anchor point definition
     Bool_t  fkUseAnchor;        //Use Anchor Logic (default: No)
     Float_t fAnchorPoint;       //Raw value below which
     Float_t fAnchorPercentile;  //Percentile of X-section at anchor point
     
-    ClassDef(AliMultEstimator, 1)
+    ClassDef(AliMultEstimator, 2)
 };
 #endif
@@ -92,6 +92,17 @@ AliMultVariable* AliMultInput::GetVariable (Long_t iIdx) const
     return static_cast<AliMultVariable*>(fVariableList->At(iIdx));
 }
 
+void AliMultInput::GetValues (Double_t *lValues) const
+{
+    //Flat copy of all variable values (in variable order) for evaluation
+    TIter next(fVariableList);
+    AliMultVariable* var = 0;
+    Long_t iVar = 0;
+    while ((var = static_cast<AliMultVariable*>(next()))) {
+        lValues[iVar++] = var->IsInteger() ? var->GetValueInteger() : var->GetValue();
+    }
+}
+
 void AliMultInput::Clear(Option_t* option)
 {
     TIter next(fVariableList);
@@ -278,6 +278,16 @@ void AliMultSelection::Evaluate( AliMultInput *lInput )
 #endif
 }
 //________________________________________________________________
+void AliMultSelection::Evaluate( const Double_t *lValues )
+//Evaluate all estimators from a flat array of input values, using
+//the compiled estimator definitions where available
+{
+    AliMultEstimator* estimator = 0;
+    TIter             next(fEstimatorList);
+    while ((estimator = static_cast<AliMultEstimator*>(next())))
+        estimator->Evaluate(lValues);
+}
+//________________________________________________________________
 void AliMultSelection::Setup(const AliMultInput* inp)
 {
     AliMultEstimator* estimator = 0;
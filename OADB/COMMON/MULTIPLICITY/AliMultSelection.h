@@ -41,6 +41,8 @@ public:
     
     //Master "Evaluate"
     void Evaluate ( AliMultInput *lInput );
+    //Same, from flat array of input values (AliMultInput::GetValues)
+    void Evaluate ( const Double_t *lValues );
     
     //Get ready: prepare/optimize TFormulas
     void Setup(const AliMultInput *lInput);
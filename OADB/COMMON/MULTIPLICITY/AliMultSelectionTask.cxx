@@ -101,7 +101,7 @@ AliMultSelectionTask::AliMultSelectionTask()
     : AliAnalysisTaskSE(), fListHist(0), fTreeEvent(0),
       fkCalibration ( kFALSE ), fkAddInfo(kTRUE), fkFilterMB(kTRUE), fkAttached(0), fkHighMultQABinning(kFALSE), fkDebug(kTRUE),
       fkDebugAliCentrality ( kFALSE ), fkDebugAliPPVsMultUtils( kFALSE ), fkDebugIsMC( kFALSE ), fkDebugAdditional2DHisto( kFALSE ),
-      fkUseDefaultCalib (kFALSE), fkUseDefaultMCCalib (kFALSE),
+      fkUseDefaultCalib (kFALSE), fkUseDefaultMCCalib (kFALSE), fkUseFastEvaluation (kFALSE),
       fDownscaleFactor(2.0), //2.0: no downscaling
       fRand(0),
       fkTrigger(AliVEvent::kINT7), fAlternateOADBForEstimators(""),
@@ -239,7 +239,8 @@ AliMultSelectionTask::AliMultSelectionTask()
 
       //Objects
       fOadbMultSelection(0),
-      fInput(0)
+      fInput(0),
+      fInputValues()
 //------------------------------------------------
 // Tree Variables
 {
@@ -250,7 +251,7 @@ AliMultSelectionTask::AliMultSelectionTask(const char *name, TString lExtraOptio
     : AliAnalysisTaskSE(name), fListHist(0), fTreeEvent(0), fESDtrackCuts(0), fTrackCuts(0), fTrackCutsGlobal2015(0), fTrackCutsITSsa2010(0), fUtils(0),
       fkCalibration ( lCalib ), fkAddInfo(kTRUE), fkFilterMB(kTRUE), fkAttached(0), fkHighMultQABinning(kFALSE), fkDebug(kTRUE),
       fkDebugAliCentrality ( kFALSE ), fkDebugAliPPVsMultUtils( kFALSE ), fkDebugIsMC ( kFALSE ), fkDebugAdditional2DHisto( kFALSE ),
-      fkUseDefaultCalib (kFALSE), fkUseDefaultMCCalib (kFALSE),
+      fkUseDefaultCalib (kFALSE), fkUseDefaultMCCalib (kFALSE), fkUseFastEvaluation (kFALSE),
       fDownscaleFactor(2.0), //2.0: no downscaling
       fRand(0),
       fkTrigger(AliVEvent::kINT7), fAlternateOADBForEstimators(""),
@@ -385,7 +386,8 @@ AliMultSelectionTask::AliMultSelectionTask(const char *name, TString lExtraOptio
       
       //Objects
       fOadbMultSelection(0),
-      fInput(0)
+      fInput(0),
+      fInputValues()
 {
 
     for( Int_t iq=0; iq<100; iq++ ) fQuantiles[iq] = -1 ;
@@ -596,6 +598,9 @@ void AliMultSelectionTask::UserCreateOutputObjects()
     fInput->AddVariable( fNPartINELgtONE           );
     fInput->AddVariable( fEvSel_VtxZ );
 
+    //Flat input buffer for the fast evaluation, one entry per variable
+    fInputValues.Set( fInput->GetNVariables() );
+
     if( fkCalibration ) {
         fTreeEvent = new TTree("fTreeEvent","Event");
 
@@ -1596,7 +1601,12 @@ void AliMultSelectionTask::UserExec(Option_t *)
         AliMultSelection*     lSelection = fOadbMultSelection->GetMultSelection();
         AliMultSelectionCuts* lMultCuts  = fOadbMultSelection->GetEventCuts();
         if(lVerbose) Printf( "--- Evaluate -2-");
-        lSelection -> Evaluate (fInput);
+        if ( fkUseFastEvaluation && fInputValues.GetSize() == fInput->GetNVariables() ) {
+            fInput -> GetValues ( fInputValues.GetArray() );
+            lSelection -> Evaluate (fInputValues.GetArray());
+        } else {
+            lSelection -> Evaluate (fInput);
+        }
         if(lVerbose) Printf( "--- INPUT --- ");
         if(lVerbose) fInput -> Print("V") ;
         if(lVerbose) Printf( "--- OUTPUT --- ");
@@ -1658,6 +1668,12 @@ void AliMultSelectionTask::UserExec(Option_t *)
         Float_t lThisQuantile = -1;
         for(Long_t iEst=0; iEst<lSelection->GetNEstimators(); iEst++) {
             //Changed: no need for run number, object already matches required one
+            if ( fkUseFastEvaluation ) {
+                lThisQuantile = fOadbMultSelection->GetPercentile( iEst, lSelection->GetEstimator(iEst)->GetValue() );
+                if( iEst < fNDebug ) fQuantiles[iEst] = lThisQuantile;
+                lSelection->GetEstimator(iEst)->SetPercentile(lThisQuantile);
+                continue;
+            }
             lThisCalibHistoName = Form("hCalib_%s",lSelection->GetEstimator(iEst)->GetName());
             lThisCalibHisto = 0x0;
             lThisCalibHisto = fOadbMultSelection->GetCalibHisto( lThisCalibHistoName );
@@ -2126,6 +2142,10 @@ Int_t AliMultSelectionTask::SetupRun(const AliVEvent* const esd)
         //Optimize evaluation
         sel->Setup(fInput);
     }
+    if ( fkUseFastEvaluation ) {
+        //Per-run percentile tables
+        fOadbMultSelection->SetupPercentileTables();
+    }
 
     AliInfo("---> Successfully set up! Inspect MultSelection:");
     if (sel) {
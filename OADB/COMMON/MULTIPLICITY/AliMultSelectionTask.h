@@ -27,6 +27,7 @@
 #define AliMultSelectionTask_H
 
 #include <AliAnalysisTaskSE.h>
+#include <TArrayD.h>
 
 class TList;
 class TH1F;
@@ -122,6 +123,10 @@ public:
     void SetUseDefaultMCCalib ( Bool_t lVar ){ fkUseDefaultMCCalib = lVar; }
     Bool_t GetUseDefaultMCCalib () const { return fkUseDefaultMCCalib; }
     
+    //Fast evaluation: compiled estimator definitions, percentile tables per run
+    void SetUseFastEvaluation ( Bool_t lVar ){ fkUseFastEvaluation = lVar; }
+    Bool_t GetUseFastEvaluation () const { return fkUseFastEvaluation; }
+    
     //Calibration mode downscaling for manageable output
     void SetDownscaleFactor ( Double_t lDownscale ) { fDownscaleFactor = lDownscale; }
     
@@ -155,6 +160,7 @@ private:
     //Default options
     Bool_t fkUseDefaultCalib; //if true, allow for default data calibration
     Bool_t fkUseDefaultMCCalib; //if true, allow for default scaling factor in MC
+    Bool_t fkUseFastEvaluation; //if true, use compiled estimators and percentile tables
     
     //Downscale factor:
     //-> if smaller than unity, reduce change of accepting a given event for calib tree
@@ -343,12 +349,14 @@ private:
     //AliMultSelection Framework
     AliOADBMultSelection *fOadbMultSelection;
     AliMultInput         *fInput;
+    TArrayD               fInputValues; //! flat copy of the input variables for fast evaluation
 
     AliMultSelectionTask(const AliMultSelectionTask&);            // not implemented
     AliMultSelectionTask& operator=(const AliMultSelectionTask&); // not implemented
 
-    ClassDef(AliMultSelectionTask, 5);
+    ClassDef(AliMultSelectionTask, 6);
     //3 - extra QA histograms
+    //6 - fast evaluation option
 };
 
 #endif
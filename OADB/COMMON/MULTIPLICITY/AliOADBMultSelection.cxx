@@ -11,13 +11,16 @@
 #include "TBrowser.h"
 #include <TMap.h>
 #include <TROOT.h>
+#include <TMath.h>
+#include <TAxis.h>
 
 ClassImp(AliOADBMultSelection);
 
 //________________________________________________________________
 //Constructors/Destructor
 AliOADBMultSelection::AliOADBMultSelection() :
-TNamed("multSel",""), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0)
+TNamed("multSel",""), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0),
+fTableOffset(), fTableNBins(), fTableEdgeOffset(), fTableXmin(), fTableXmax(), fTableEdges(), fTableContent()
 {
     // constructor
     // fCalibList = new TList();
@@ -29,7 +32,8 @@ AliOADBMultSelection::AliOADBMultSelection(const AliOADBMultSelection& o)
 fCalibList(0),
 fEventCuts(0),
 fSelection(0),
-fMap(0)
+fMap(0),
+fTableOffset(), fTableNBins(), fTableEdgeOffset(), fTableXmin(), fTableXmax(), fTableEdges(), fTableContent()
 {
     fCalibList = new TList();
     fCalibList->SetOwner (kTRUE);
@@ -41,7 +45,8 @@ fMap(0)
 }
 //________________________________________________________________
 AliOADBMultSelection::AliOADBMultSelection(const char * name, const char * title) :
-TNamed(name, title), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0)
+TNamed(name, title), fCalibList(0), fEventCuts(0), fSelection(0), fMap(0),
+fTableOffset(), fTableNBins(), fTableEdgeOffset(), fTableXmin(), fTableXmax(), fTableEdges(), fTableContent()
 {
     // constructor
     fCalibList = new TList();
@@ -61,6 +66,7 @@ AliOADBMultSelection& AliOADBMultSelection::operator=(const AliOADBMultSelection
         delete fMap;
         fMap = 0;
     }
+    fTableOffset.Set(0);
     fCalibList = new TList();
     fCalibList->SetOwner (kTRUE);
     TIter next(o.fCalibList);
@@ -250,3 +256,68 @@ void AliOADBMultSelection::Setup()
 }
 
 
+//________________________________________________________________
+void AliOADBMultSelection::SetupPercentileTables()
+{
+    //Copy the calibration histogram of each estimator into flat
+    //tables, such that GetPercentile does not need a name look-up
+    //nor a histogram call per event. To be called once per run,
+    //after the estimators and calibration histograms are final.
+    AliMultSelection* sel = GetMultSelection();
+    const Long_t lNEst = sel ? sel->GetNEstimators() : 0;
+    fTableOffset.Set(lNEst);
+    fTableNBins.Set(lNEst);
+    fTableEdgeOffset.Set(lNEst);
+    fTableXmin.Set(lNEst);
+    fTableXmax.Set(lNEst);
+    fTableEdges.Set(0);
+    fTableContent.Set(0);
+    
+    for(Long_t iEst=0; iEst<lNEst; iEst++) {
+        fTableOffset[iEst] = -1;
+        fTableEdgeOffset[iEst] = -1;
+        AliMultEstimator* e = sel->GetEstimator(iEst);
+        TH1F* h = e ? GetCalibHisto(TString(Form("hCalib_%s", e->GetName()))) : 0;
+        if (!h) continue;
+        
+        const TAxis* lAxis = h->GetXaxis();
+        const Int_t lNBins = lAxis->GetNbins();
+        fTableNBins[iEst] = lNBins;
+        fTableXmin[iEst]  = lAxis->GetXmin();
+        fTableXmax[iEst]  = lAxis->GetXmax();
+        if (lAxis->GetXbins()->GetSize() > 0) {
+            const Int_t lEdgeOffset = fTableEdges.GetSize();
+            fTableEdges.Set(lEdgeOffset + lNBins + 1);
+            for(Int_t iEdge=0; iEdge<=lNBins; iEdge++) fTableEdges[lEdgeOffset+iEdge] = lAxis->GetXbins()->At(iEdge);
+            fTableEdgeOffset[iEst] = lEdgeOffset;
+        }
+        const Int_t lOffset = fTableContent.GetSize();
+        fTableContent.Set(lOffset + lNBins + 2);
+        for(Int_t iBin=0; iBin<=lNBins+1; iBin++) fTableContent[lOffset+iBin] = h->GetBinContent(iBin);
+        fTableOffset[iEst] = lOffset;
+    }
+}
+//________________________________________________________________
+Float_t AliOADBMultSelection::GetPercentile(Long_t iEst, Double_t lValue) const
+{
+    //Percentile of estimator iEst, equivalent to
+    //hCalib->GetBinContent(hCalib->FindBin(lValue))
+    if (iEst < 0 || iEst >= fTableOffset.GetSize() || fTableOffset[iEst] < 0)
+        return AliMultSelectionCuts::kNoCalib;
+    
+    const Int_t    lNBins = fTableNBins[iEst];
+    const Double_t lXmin  = fTableXmin[iEst];
+    const Double_t lXmax  = fTableXmax[iEst];
+    Int_t lBin;
+    if (lValue < lXmin) {
+        lBin = 0;
+    } else if ( !(lValue < lXmax) ) {
+        lBin = lNBins+1;
+    } else if (fTableEdgeOffset[iEst] < 0) {
+        //Uniform binning: same arithmetic as TAxis::FindFixBin
+        lBin = 1 + Int_t(lNBins*(lValue-lXmin)/(lXmax-lXmin));
+    } else {
+        lBin = 1 + TMath::BinarySearch(lNBins+1, fTableEdges.GetArray()+fTableEdgeOffset[iEst], lValue);
+    }
+    return fTableContent[fTableOffset[iEst]+lBin];
+}
@@ -2,6 +2,9 @@
 #define ALIOADBMULTSELECTION_H
 
 #include <TNamed.h>
+#include <TArrayI.h>
+#include <TArrayF.h>
+#include <TArrayD.h>
 #include <AliMultSelection.h>
 class TBrowser;
 class TH1F;
@@ -39,6 +42,10 @@ public:
     //Use internal map
     void Setup();
     TH1F* FindHisto(AliMultEstimator* e);
+    
+    //Percentile look-up tables (per estimator index) from calibration histograms
+    void SetupPercentileTables();
+    Float_t GetPercentile(Long_t iEst, Double_t lValue) const;
     void Print(Option_t* option="") const;
     
 private:
@@ -46,7 +53,14 @@ private:
     AliMultSelectionCuts * fEventCuts; // EventCuts
     AliMultSelection     * fSelection; // Definition of Estimators
     TMap*                  fMap; //! Map estimator to histogram
-    ClassDef(AliOADBMultSelection, 1)
+    TArrayI fTableOffset;   //! per estimator: first bin in fTableContent (-1: no calibration)
+    TArrayI fTableNBins;    //! per estimator: number of bins
+    TArrayI fTableEdgeOffset; //! per estimator: first edge in fTableEdges (-1: uniform binning)
+    TArrayD fTableXmin;     //! per estimator: lower edge of the axis
+    TArrayD fTableXmax;     //! per estimator: upper edge of the axis
+    TArrayD fTableEdges;    //! bin edges of variable-binned histograms
+    TArrayF fTableContent;  //! bin contents including under- and overflow
+    ClassDef(AliOADBMultSelection, 2)
     
     
 };
@@ -53,6 +53,7 @@ class AliAODRecoDecay;
 #include "TObjArray.h"
 #include "AliAnalysisFilter.h"
 #include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackColumns.h"
 
 #include <TFile.h>
 #include <TDatabasePDG.h>
@@ -101,6 +102,8 @@ AliAODBranchReplicator(),
   fNumberOfHeaderParamInt(0),
   fSaveAODZDC(0),
   fSaveVzero(0),
+  fSaveTrackColumns(0),
+  fTrackColumns(0x0),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
   fVarListHeader_fTC(""){
@@ -132,6 +135,8 @@ AliNanoAODReplicator::AliNanoAODReplicator(const char* name, const char* title,
   fNumberOfHeaderParamInt(0),
   fSaveAODZDC(0),
   fSaveVzero(0),
+  fSaveTrackColumns(0),
+  fTrackColumns(0x0),
   fInputArrayName(""),
   fOutputArrayName("tracks"),
   fVarListHeader_fTC("")
@@ -158,6 +163,8 @@ AliNanoAODReplicator::~AliNanoAODReplicator()
   // dtor
   delete fTrackCut;
   delete fList;
+  // the track array is not in the list if only the columns are saved
+  if (fSaveTrackColumns == 2) delete fTracks;
 }
 
 //_____________________________________________________________________________
@@ -437,7 +444,13 @@ TList* AliNanoAODReplicator::GetList() const
 
       fTracks = new TClonesArray("AliNanoAODTrack");
       fTracks->SetName(fOutputArrayName.Data()); // TODO: consider the possibility to use a different name to distinguish in AliAODEvent
-      fList->Add(fTracks);
+      if (fSaveTrackColumns != 2) fList->Add(fTracks);
+
+      if (fSaveTrackColumns > 0) {
+        // one contiguous column per track variable instead of one object per track
+        fTrackColumns = new AliNanoAODTrackColumns();
+        fList->Add(fTrackColumns);
+      }
 
       fHeader = new AliNanoAODHeader(fNumberOfHeaderParam, fNumberOfHeaderParamInt);
       fHeader->SetName("header"); // TODO: consider the possibility to use a different name to distinguish in AliAODEvent
@@ -485,6 +498,7 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
   
 
   fTracks->Clear("C");			
+  if (fTrackColumns) fTrackColumns->Clear();
   assert(fVertices!=0x0);
   fVertices->Clear("C");
   if (fMCMode > 0){
@@ -575,6 +589,9 @@ void AliNanoAODReplicator::ReplicateAndFilter(const AliAODEvent& source)
     FilterMC(source);      
   }
   
+  // Store the tracks (with remapped labels) in columns
+  if (fTrackColumns) fTrackColumns->Fill(fTracks);
+  
 
 }
 
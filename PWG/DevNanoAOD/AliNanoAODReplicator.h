@@ -54,6 +54,7 @@ class AliAODHeader;
 class AliNanoAODHeader;
 class AliAnalysisTaskSE;
 class AliNanoAODTrack;
+class AliNanoAODTrackColumns;
 class AliAODTrack;
 class AliNanoAODCustomSetter;
 class AliAODZDC;
@@ -92,9 +93,11 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
     
   void SetVzero(Int_t b) { fSaveVzero = b;}
   void SetAODZDC(Int_t b) { fSaveAODZDC = b;}
+  void SetTrackColumns(Int_t b) { fSaveTrackColumns = b;}
   
   Int_t GetSaveVzero() {return fSaveVzero;}
   Int_t GetSaveAODZDC() {return fSaveAODZDC;}
+  Int_t GetSaveTrackColumns() {return fSaveTrackColumns;}
 
   void SetNumberOfHaederParam(Int_t var){fNumberOfHeaderParam=var;}
   void SetNumberOfHaederParamInt(Int_t var){fNumberOfHeaderParamInt=var;}
@@ -143,6 +146,8 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
     
   Int_t fSaveAODZDC;  // if kTRUE AliAODZDC will be saved in AliAODEvent
   Int_t fSaveVzero;  // if kTRUE AliAODVZERO will be saved in AliAODEvent
+  Int_t fSaveTrackColumns; // 0: tracks saved as AliNanoAODTrack array, 1: also as AliNanoAODTrackColumns, 2: only as AliNanoAODTrackColumns
+  mutable AliNanoAODTrackColumns* fTrackColumns; //! columnar copy of the tracks
 
   TString fInputArrayName; // name of array if tracks are stored in a TObjectArray
   TString fOutputArrayName; // name of the output array, where the NanoAODTracks are stored
@@ -152,7 +157,7 @@ class AliNanoAODReplicator : public AliAODBranchReplicator
   AliNanoAODReplicator(const AliNanoAODReplicator&);
   AliNanoAODReplicator& operator=(const AliNanoAODReplicator&);
 
-  ClassDef(AliNanoAODReplicator,4) // Branch replicator for ESD to muon AOD.
+  ClassDef(AliNanoAODReplicator,5) // Branch replicator for ESD to muon AOD.
 };
 
 #endif
@@ -0,0 +1,179 @@
+/**************************************************************************
+ * Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ *                                                                        *
+ * Author: The ALICE Off-line Project.                                    *
+ * Contributors are mentioned in the code where appropriate.              *
+ *                                                                        *
+ * Permission to use, copy, modify and distribute this software and its   *
+ * documentation strictly for non-commercial purposes is hereby granted   *
+ * without fee, provided that the above copyright notice appears in all   *
+ * copies and that both the copyright notice and this permission notice   *
+ * appear in the supporting documentation. The authors make no claims     *
+ * about the suitability of this software for any purpose. It is          *
+ * provided "as is" without express or implied warranty.                  *
+ **************************************************************************/
+
+
+//-------------------------------------------------------------------------
+//     Columnar storage of NanoAOD tracks, see header file
+//-------------------------------------------------------------------------
+
+#include "TClonesArray.h"
+#include "TObjArray.h"
+#include "TObjString.h"
+#include "AliLog.h"
+#include "AliAODTrack.h"
+
+#include "AliNanoAODTrack.h"
+#include "AliNanoAODTrackMapping.h"
+#include "AliNanoAODTrackColumns.h"
+
+ClassImp(AliNanoAODTrackColumns)
+
+const char * AliNanoAODTrackColumns::fgkResolvedVarNames[AliNanoAODTrackColumns::kNResolvedVars] = {
+  "pt", "phi", "theta", "chi2perNDF", "posx", "posy", "posz",
+  "posDCAx", "posDCAy", "TPCncls", "TPCnclsF", "TPCNCrossedRows",
+  "TPCsignal", "TOFsignal", "FilterMap"
+};
+
+//______________________________________________________________________________
+AliNanoAODTrackColumns::AliNanoAODTrackColumns(const char * name) :
+  TNamed(name, name),
+  fVarList(""),
+  fNColumns(0),
+  fNTracks(0),
+  fValues(),
+  fLabels(),
+  fCharges(),
+  fIsDCA(),
+  fResolvedVarList(""),
+  fResolvedData(0),
+  fResolvedNTracks(-1)
+{
+  // default constructor
+  for (Int_t ivar = 0; ivar < kNResolvedVars; ivar++) {
+    fResolvedIndex[ivar] = -1;
+    fResolvedColumn[ivar] = 0;
+  }
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::Clear(Option_t * /*opt*/)
+{
+  // empty the columns, keeping the allocated memory for the next event
+  fNTracks = 0;
+  fValues.clear();
+  fLabels.clear();
+  fCharges.clear();
+  fIsDCA.clear();
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::Fill(const TClonesArray * tracks)
+{
+  // Fill the columns from an array of AliNanoAODTrack. The variables
+  // are taken from the current AliNanoAODTrackMapping.
+
+  Clear();
+  if (!tracks) return;
+
+  AliNanoAODTrackMapping * mapping = AliNanoAODTrackMapping::GetInstance();
+  if (fNColumns != mapping->GetSize()) {
+    fNColumns = mapping->GetSize();
+    fVarList = "";
+    for (Int_t icol = 0; icol < fNColumns; icol++) {
+      if (icol) fVarList += ",";
+      fVarList += mapping->GetVarName(icol);
+    }
+  }
+
+  fNTracks = tracks->GetEntriesFast();
+  fValues.resize(fNColumns*fNTracks);
+  fLabels.resize(fNTracks);
+  fCharges.resize(fNTracks);
+  fIsDCA.resize(fNTracks);
+
+  for (Int_t itrack = 0; itrack < fNTracks; itrack++) {
+    const AliNanoAODTrack * track = static_cast<const AliNanoAODTrack*>(tracks->UncheckedAt(itrack));
+    for (Int_t icol = 0; icol < fNColumns; icol++) {
+      fValues[icol*fNTracks + itrack] = track->GetVar(icol);
+    }
+    fLabels[itrack]  = track->GetLabel();
+    fCharges[itrack] = track->Charge();
+    fIsDCA[itrack]   = track->TestBit(AliAODTrack::kIsDCA);
+  }
+}
+
+//______________________________________________________________________________
+Bool_t AliNanoAODTrackColumns::FillTrack(Int_t i, AliNanoAODTrack * track) const
+{
+  // Fill an AliNanoAODTrack (created with the same variable list)
+  // with the content of track i, for the existing AliNanoAODTrack
+  // consumers. The production vertex reference is not stored in the
+  // columns.
+
+  if (!track || i < 0 || i >= fNTracks) return kFALSE;
+
+  for (Int_t icol = 0; icol < fNColumns; icol++) {
+    track->SetVar(icol, fValues[icol*fNTracks + i]);
+  }
+  track->SetLabel(fLabels[i]);
+  track->SetCharge(fCharges[i]);
+  if (fIsDCA[i]) track->SetBit(AliAODTrack::kIsDCA);
+  else track->ResetBit(AliAODTrack::kIsDCA);
+
+  return kTRUE;
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::FillTrackArray(TClonesArray * tracks) const
+{
+  // Fill an array of AliNanoAODTrack with all the tracks in the
+  // columns (compatibility with the object-per-track layout)
+
+  if (!tracks) return;
+  tracks->Clear("C");
+
+  for (Int_t itrack = 0; itrack < fNTracks; itrack++) {
+    AliNanoAODTrack * track = new((*tracks)[itrack]) AliNanoAODTrack(fVarList.Data());
+    FillTrack(itrack, track);
+  }
+}
+
+//______________________________________________________________________________
+Int_t AliNanoAODTrackColumns::GetColumnIndex(const char * varName) const
+{
+  // Get the column of a variable from its name (-1 if not stored)
+
+  TObjArray * vars = fVarList.Tokenize(",");
+  Int_t index = -1;
+  for (Int_t icol = 0; icol < vars->GetEntriesFast(); icol++) {
+    if (static_cast<TObjString*>(vars->UncheckedAt(icol))->String() == varName) {
+      index = icol;
+      break;
+    }
+  }
+  delete vars;
+  return index;
+}
+
+//______________________________________________________________________________
+void AliNanoAODTrackColumns::ResolveColumns() const
+{
+  // Resolve the columns of the most used variables. The name lookup is
+  // only done when the variable list changes, the column pointers are
+  // updated whenever the content of the columns was refilled or read.
+
+  if (fResolvedVarList != fVarList) {
+    for (Int_t ivar = 0; ivar < kNResolvedVars; ivar++) {
+      fResolvedIndex[ivar] = GetColumnIndex(fgkResolvedVarNames[ivar]);
+    }
+    fResolvedVarList = fVarList;
+  }
+
+  for (Int_t ivar = 0; ivar < kNResolvedVars; ivar++) {
+    fResolvedColumn[ivar] = GetColumn(fResolvedIndex[ivar]);
+  }
+  fResolvedData = fValues.empty() ? 0 : &fValues[0];
+  fResolvedNTracks = fNTracks;
+}
@@ -0,0 +1,134 @@
+#ifndef AliNanoAODTrackColumns_H
+#define AliNanoAODTrackColumns_H
+/* Copyright(c) 1998-2007, ALICE Experiment at CERN, All rights reserved. *
+ * See cxx source for full Copyright notice                               */
+
+
+//-------------------------------------------------------------------------
+//     Columnar storage of NanoAOD tracks
+//     All the tracks of an event are stored with one contiguous column
+//     per variable of the track mapping (fValues[column*fNTracks+track]),
+//     plus the label, charge and DCA flag of each track. This avoids the
+//     streaming of one AliNanoAODTrack object per track.
+//
+//     The column of the most used variables is resolved once from the
+//     variable list (not at every access through the mapping singleton),
+//     and the lightweight View gives direct indexed access:
+//
+//       AliNanoAODTrackColumns * cols = (AliNanoAODTrackColumns*) aod->FindListObject("trackColumns");
+//       for (Int_t i = 0; i < cols->GetNTracks(); i++) {
+//         AliNanoAODTrackColumns::View track = cols->GetTrack(i);
+//         if (track.TestFilterBit(768)) hist->Fill(track.Pt());
+//       }
+//
+//     The columns are written by AliNanoAODReplicator::SetTrackColumns(mode):
+//       0 (default) only the AliNanoAODTrack array, as before
+//       1 the AliNanoAODTrack array and the columns ("trackColumns")
+//       2 only the columns
+//     With mode 0 or 1 existing readers of the AliNanoAODTrack array need
+//     no change. With mode 2 they have to rebuild the array from the
+//     columns with FillTrack/FillTrackArray.
+//-------------------------------------------------------------------------
+
+#include <vector>
+#include "TNamed.h"
+#include "TString.h"
+#include "TMath.h"
+
+class TClonesArray;
+class AliNanoAODTrack;
+
+class AliNanoAODTrackColumns : public TNamed {
+
+public:
+
+  // Variables with a resolved column for direct access
+  enum EResolvedVar {
+    kPt = 0, kPhi, kTheta, kChi2PerNDF, kPosX, kPosY, kPosZ,
+    kPosDCAx, kPosDCAy, kTPCncls, kTPCnclsF, kTPCNCrossedRows,
+    kTPCsignal, kTOFsignal, kFilterMap,
+    kNResolvedVars
+  };
+
+  //______________________________________________________________________________
+  // Lightweight view of one track in the columns. Not meant to be stored.
+  class View {
+  public:
+    View(const AliNanoAODTrackColumns * cols, Int_t index) : fCols(cols), fIndex(index) {;}
+
+    Int_t    GetIndex()   const { return fIndex; }
+    Double_t GetVar(Int_t column) const { return fCols->fValues[column*fCols->fNTracks + fIndex]; }
+    Double_t GetResolved(EResolvedVar var) const { const Float_t * col = fCols->fResolvedColumn[var]; return col ? col[fIndex] : -999.; }
+    UInt_t   GetResolvedUnsigned(EResolvedVar var) const { const Float_t * col = fCols->fResolvedColumn[var]; return col ? UInt_t(col[fIndex]) : 0; } // 0 if not stored
+
+    Double_t Pt()         const { return GetResolved(kPt);    }
+    Double_t Phi()        const { return GetResolved(kPhi);   }
+    Double_t Theta()      const { return GetResolved(kTheta); }
+    Double_t Eta()        const { return -TMath::Log(TMath::Tan(0.5 * Theta())); }
+    Double_t Px()         const { return Pt() * TMath::Cos(Phi()); }
+    Double_t Py()         const { return Pt() * TMath::Sin(Phi()); }
+    Double_t Pz()         const { return Pt() / TMath::Tan(Theta()); }
+    Double_t Chi2perNDF() const { return GetResolved(kChi2PerNDF); }
+    Double_t XAtDCA()     const { return GetResolved(kPosDCAx); }
+    Double_t YAtDCA()     const { return GetResolved(kPosDCAy); }
+    UShort_t GetTPCNcls()         const { return GetResolvedUnsigned(kTPCncls); }
+    UShort_t GetTPCNclsF()        const { return GetResolvedUnsigned(kTPCnclsF); }
+    UShort_t GetTPCNCrossedRows() const { return GetResolvedUnsigned(kTPCNCrossedRows); }
+    Double_t GetTPCsignal()       const { return GetResolved(kTPCsignal); }
+    Double_t GetTOFsignal()       const { return GetResolved(kTOFsignal); }
+    UInt_t   GetFilterMap()       const { return GetResolvedUnsigned(kFilterMap); }
+    Bool_t   TestFilterBit(UInt_t filterBit) const { return (filterBit & GetFilterMap()) != 0; }
+    Short_t  Charge()     const { return fCols->fCharges[fIndex]; }
+    Int_t    GetLabel()   const { return fCols->fLabels[fIndex]; }
+    Bool_t   IsDCA()      const { return fCols->fIsDCA[fIndex]; }
+
+  private:
+    const AliNanoAODTrackColumns * fCols; // columns the track belongs to
+    Int_t fIndex;                         // index of the track in the columns
+  };
+
+  AliNanoAODTrackColumns(const char * name = "trackColumns");
+  virtual ~AliNanoAODTrackColumns() {;}
+
+  virtual void Clear(Option_t * opt = "");
+
+  void  Fill(const TClonesArray * tracks);
+  Bool_t FillTrack(Int_t i, AliNanoAODTrack * track) const;
+  void  FillTrackArray(TClonesArray * tracks) const;
+
+  Int_t GetNTracks()  const { return fNTracks; }
+  Int_t GetNColumns() const { return fNColumns; }
+  const char * GetVarList() const { return fVarList.Data(); }
+  Int_t GetColumnIndex(const char * varName) const;
+  const Float_t * GetColumn(Int_t column) const { return (column >= 0 && column < fNColumns && fNTracks > 0) ? &fValues[column*fNTracks] : 0; }
+  View  GetTrack(Int_t i) const { if (fResolvedData != (fValues.empty() ? 0 : &fValues[0]) || fResolvedNTracks != fNTracks) ResolveColumns(); return View(this, i); }
+
+  static const char * GetResolvedVarName(EResolvedVar var) { return fgkResolvedVarNames[var]; }
+
+private:
+
+  void ResolveColumns() const;
+
+  AliNanoAODTrackColumns(const AliNanoAODTrackColumns&);
+  AliNanoAODTrackColumns& operator=(const AliNanoAODTrackColumns&);
+
+  TString               fVarList;         // comma separated list of the variables, one column each (as in AliNanoAODTrackMapping)
+  Int_t                 fNColumns;        // number of columns
+  Int_t                 fNTracks;         // number of tracks in the event
+  std::vector<Float_t>  fValues;          // values, one contiguous column per variable
+  std::vector<Int_t>    fLabels;          // track labels
+  std::vector<Short_t>  fCharges;         // track charges
+  std::vector<UChar_t>  fIsDCA;           // whether the position variables hold DCA information (AliAODTrack::kIsDCA)
+
+  mutable Int_t           fResolvedIndex[kNResolvedVars];  //! column of the resolved variables (-1 if not stored)
+  mutable const Float_t * fResolvedColumn[kNResolvedVars]; //! start of the column of the resolved variables
+  mutable TString         fResolvedVarList;                //! variable list the column indices were resolved for
+  mutable const Float_t * fResolvedData;                   //! value buffer the column pointers were resolved for
+  mutable Int_t           fResolvedNTracks;                //! number of tracks the column pointers were resolved for
+
+  static const char * fgkResolvedVarNames[kNResolvedVars]; // names of the resolved variables in the track mapping
+
+  ClassDef(AliNanoAODTrackColumns, 1);
+};
+
+#endif
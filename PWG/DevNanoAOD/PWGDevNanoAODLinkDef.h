@@ -6,6 +6,7 @@
 #pragma link C++ class AliNanoAODReplicator+;
 #pragma link C++ class AliAnalysisTaskNanoAODFilter+;
 #pragma link C++ class AliNanoAODTrack+;
+#pragma link C++ class AliNanoAODTrackColumns+;
 #pragma link C++ class AliNanoAODCustomSetter+;
 #pragma link C++ class AliAnalysisNanoAODTrackCuts+;
 #pragma link C++ class AliAnalysisNanoAODEventCuts+;
@@ -77,6 +77,7 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper() :
   fRandomEventNumberAccess(kFALSE),
   fRandomFileAccess(kTRUE),
   fCreateHisto(true),
+  fSelectBeforeFullLoad(false),
   fAutoConfigurePtHardBins(false),
   fAutoConfigureBasePath(""),
   fAutoConfigureTrainTypePath(""),
@@ -138,6 +139,7 @@ AliAnalysisTaskEmcalEmbeddingHelper::AliAnalysisTaskEmcalEmbeddingHelper(const c
   fRandomEventNumberAccess(kFALSE),
   fRandomFileAccess(kTRUE),
   fCreateHisto(true),
+  fSelectBeforeFullLoad(false),
   fAutoConfigurePtHardBins(false),
   fAutoConfigureBasePath("alien:///alice/cern.ch/user/a/alitrain/"),
   fAutoConfigureTrainTypePath("PWGJE/Jets_EMC_PbPb/"),
@@ -676,6 +678,14 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::GetNextEntry()
 
   } while (!IsEventSelected());
 
+  // Only the selection branches were read so far. Read the full accepted entry.
+  if (fSelectBeforeFullLoad) {
+    SetReadSelectionBranchesOnly(false);
+    fChain->GetEntry(fCurrentEntry - 1);
+    SetEmbeddedEventProperties();
+    SetReadSelectionBranchesOnly(true);
+  }
+
   if (fCreateHisto) {
     fHistManager.FillTH1("fHistEventCount", "Accepted");
     fHistManager.FillTH1("fHistEmbeddedEventsAttempted", attempts);
@@ -880,9 +890,49 @@ Bool_t AliAnalysisTaskEmcalEmbeddingHelper::InitEvent()
 
   fExternalEvent->ReadFromTree(fChain, fTreeName);
 
+  if (fSelectBeforeFullLoad) {
+    if (dynamic_cast<AliAODEvent*>(fExternalEvent)) {
+      SetReadSelectionBranchesOnly(true);
+    }
+    else {
+      AliWarning("Reading only the selection branches is only available for AODs. Reading full entries instead.");
+      fSelectBeforeFullLoad = false;
+    }
+  }
+
   return kTRUE;
 }
 
+/**
+ * Enable either only the branches of the external tree which are needed for the embedded event selection
+ * (header, vertices and MC header), or all branches. The branch status is kept by the TChain, so it also
+ * applies to the trees of the following files.
+ *
+ * Rejected entries are then only read partially, while the event properties and the QA histograms
+ * (trials, cross section, pt hard, rejection reasons) are still filled for every attempted entry.
+ *
+ * @param[in] selectionOnly If true, only the selection branches are read. Otherwise, all branches are read.
+ */
+void AliAnalysisTaskEmcalEmbeddingHelper::SetReadSelectionBranchesOnly(bool selectionOnly)
+{
+  if (!fChain) return;
+
+  if (!selectionOnly) {
+    fChain->SetBranchStatus("*", 1);
+    return;
+  }
+
+  fChain->SetBranchStatus("*", 0);
+  const char * selectionBranches[] = {"header", "vertices", AliAODMCHeader::StdBranchName()};
+  for (auto branchName : selectionBranches) {
+    if (!fChain->GetBranch(branchName)) {
+      AliDebugStream(3) << "Selection branch " << branchName << " is not available in the external tree.\n";
+      continue;
+    }
+    fChain->SetBranchStatus(TString::Format("%s*", branchName), 1);
+  }
+}
+
 /**
  * Performing run-independent initialization to setup embedding.
  *
@@ -1425,6 +1475,7 @@ std::string AliAnalysisTaskEmcalEmbeddingHelper::toString(bool includeFileList)
   tempSS << "Tree name: " << fTreeName << "\n";
   tempSS << "Random event number access: " << fRandomEventNumberAccess << "\n";
   tempSS << "Random file access: " << fRandomFileAccess << "\n";
+  tempSS << "Select before full load: " << fSelectBeforeFullLoad << "\n";
   tempSS << "Starting file index: " << fFilenameIndex << "\n";
   tempSS << "Number of files to embed: " << fFilenames.size() << "\n";
   tempSS << "YAML configuration path: " << fConfigurationPath << "\n";
@@ -95,6 +95,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   TString GetTreeName()                                     const { return fTreeName; }
   Bool_t GetRandomEventNumberAccess()                       const { return fRandomEventNumberAccess; }
   Bool_t GetRandomFileAccess()                              const { return fRandomFileAccess; }
+  bool GetSelectBeforeFullLoad()                            const { return fSelectBeforeFullLoad; }
   TString GetFilePattern()                                  const { return fFilePattern; }
   TString GetInputFilename()                                const { return fInputFilename; }
   Int_t GetStartingFileIndex()                              const { return fFilenameIndex; }
@@ -117,6 +118,11 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   void SetRandomEventNumberAccess(Bool_t b)                       { fRandomEventNumberAccess = b; }
   /// Randomly select the first file to embed from the file list. Continues sequentially afterwards
   void SetRandomFileAccess(Bool_t b)                              { fRandomFileAccess = b; }
+  /**
+   * Only read the branches needed by the embedded event selection (header, vertices, MC header) until
+   * an entry is accepted, and read the full entry only for accepted events. Only available for AODs.
+   */
+  void SetSelectBeforeFullLoad(bool b = true)                     { fSelectBeforeFullLoad = b; }
   /// Sets the file pattern to select AliEn files. This pattern is used as input to the alien_find command.
   void SetFilePattern(const char * pattern)                       { fFilePattern = pattern; }
   /**
@@ -221,6 +227,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t          IsEventSelected()     ;
   Bool_t          CheckIsEmbeddedEventSelected();
   Bool_t          InitEvent()           ;
+  void            SetReadSelectionBranchesOnly(bool selectionOnly);
   void            InitTree()            ;
   bool            PythiaInfoFromCrossSectionFile(std::string filename);
   Bool_t          IsGoodEmbeddedRun(TString path);
@@ -242,6 +249,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   Bool_t                                        fRandomEventNumberAccess; ///<  If true, it will start embedding from a random entry in the file rather than from the first
   Bool_t                                        fRandomFileAccess ; ///<  If true, it will start embedding from a random file in the input files list
   bool                                          fCreateHisto      ; ///<  If true, create QA histograms
+  bool                                          fSelectBeforeFullLoad; ///<  If true, only the branches needed by the event selection are read before an entry is accepted
 
   bool                                    fAutoConfigurePtHardBins; ///<  If true, attempt to auto configure pt hard bins. Only works on the LEGO train.
   std::string                               fAutoConfigureBasePath; ///<  The base path to the auto configuration (for example, "/alice/cern.ch/user/a/alitrain/")
@@ -283,7 +291,7 @@ class AliAnalysisTaskEmcalEmbeddingHelper : public AliAnalysisTaskSE {
   AliAnalysisTaskEmcalEmbeddingHelper &operator=(const AliAnalysisTaskEmcalEmbeddingHelper&); // not implemented
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 8);
+  ClassDef(AliAnalysisTaskEmcalEmbeddingHelper, 9);
   /// \endcond
 };
 #endif
@@ -138,7 +138,7 @@ AliVCluster* AliClusterContainer::GetAcceptCluster(Int_t i) const
   if (!vc) return 0;
 
   UInt_t rejectionReason = 0;
-  if (AcceptCluster(vc, rejectionReason))
+  if (fUseAcceptCache ? AcceptObjectCached(i, rejectionReason) : AcceptCluster(vc, rejectionReason))
     return vc;
   else {
     AliDebug(2,"Cluster not accepted.");
@@ -412,6 +412,8 @@ Bool_t AliClusterContainer::ApplyClusterCuts(const AliVCluster* clus, UInt_t &re
  */
 Int_t AliClusterContainer::GetNAcceptedClusters() const
 {
+  if (fUseAcceptCache) return GetNAcceptEntries();
+
   UInt_t rejectionReason = 0;
   Int_t nClus = 0;
   for(int iclust = 0; iclust < this->fClArray->GetEntries(); ++iclust){
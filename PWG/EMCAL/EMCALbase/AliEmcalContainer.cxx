@@ -51,10 +51,15 @@ AliEmcalContainer::AliEmcalContainer():
   fMaxMCLabel(-1),
   fMassHypothesis(-1),
   fIsEmbedding(kFALSE),
+  fUseAcceptCache(kFALSE),
   fClArray(0),
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fAcceptCacheValid(kFALSE),
+  fNAcceptCache(-1),
+  fAcceptCacheStatus(),
+  fAcceptCacheReason(),
   fClassName()
 {
   fVertex[0] = 0;
@@ -88,10 +93,15 @@ AliEmcalContainer::AliEmcalContainer(const char *name):
   fMaxMCLabel(-1),
   fMassHypothesis(-1),
   fIsEmbedding(kFALSE),
+  fUseAcceptCache(kFALSE),
   fClArray(0),
   fCurrentID(0),
   fLabelMap(0),
   fLoadedClass(0),
+  fAcceptCacheValid(kFALSE),
+  fNAcceptCache(-1),
+  fAcceptCacheStatus(),
+  fAcceptCacheReason(),
   fClassName()
 {
   fVertex[0] = 0;
@@ -153,6 +163,7 @@ void AliEmcalContainer::SetArray(const AliVEvent *event)
   if (!event) return;
 
   GetVertexFromEvent(event);
+  ResetAcceptCache();
 
   if (!fClArrayName.IsNull() && !fClArray) {
     fClArray = dynamic_cast<TClonesArray*>(event->FindListObject(fClArrayName));
@@ -184,6 +195,8 @@ void AliEmcalContainer::SetArray(const AliVEvent *event)
  */
 void AliEmcalContainer::NextEvent(const AliVEvent * event)
 {
+  ResetAcceptCache();
+
   // Get the right event (either the current event of the embedded event)
   event = AliEmcalContainerUtils::GetEvent(event, fIsEmbedding);
 
@@ -193,18 +206,55 @@ void AliEmcalContainer::NextEvent(const AliVEvent * event)
 }
 
 /**
- * Count accepted entries in the container
+ * Count accepted entries in the container. If the accept cache is enabled
+ * the count is evaluated only once per event.
  * @return Number of accepted events in the container
  */
 Int_t AliEmcalContainer::GetNAcceptEntries() const{
+  if (fUseAcceptCache && fAcceptCacheValid && fNAcceptCache >= 0 && fAcceptCacheStatus.GetSize() == GetNEntries()) return fNAcceptCache;
+
   Int_t result = 0;
   for(int index = 0; index < GetNEntries(); index++){
     UInt_t rejectionReason = 0;
-    if(AcceptObject(index, rejectionReason)) result++;
+    if(AcceptObjectCached(index, rejectionReason)) result++;
   }
+  if (fUseAcceptCache) fNAcceptCache = result;
   return result;
 }
 
+/**
+ * Check whether the object at a given index is accepted, using the per-event
+ * accept cache if enabled (see SetUseAcceptCache). The selection of each
+ * object is then evaluated at most once per event; the cache is reset in
+ * NextEvent and SetArray. Cuts changed in the middle of an event require an
+ * explicit call to ResetAcceptCache.
+ * @param[in] i Index of the object in the container
+ * @param[out] rejectionReason Bitmap of the cuts the object failed
+ * @return True if the object is accepted, false otherwise
+ */
+Bool_t AliEmcalContainer::AcceptObjectCached(Int_t i, UInt_t &rejectionReason) const
+{
+  const Int_t n = GetNEntries();
+  if (!fUseAcceptCache || i < 0 || i >= n) return AcceptObject(i, rejectionReason);
+
+  if (!fAcceptCacheValid || fAcceptCacheStatus.GetSize() != n) {
+    fAcceptCacheStatus.Set(n);
+    fAcceptCacheStatus.Reset();
+    fAcceptCacheReason.Set(n);
+    fNAcceptCache = -1;
+    fAcceptCacheValid = kTRUE;
+  }
+
+  if (fAcceptCacheStatus[i] == 0) {
+    UInt_t reason = 0;
+    fAcceptCacheStatus[i] = AcceptObject(i, reason) ? 1 : 2;
+    fAcceptCacheReason[i] = reason;
+  }
+
+  rejectionReason |= fAcceptCacheReason[i];
+  return fAcceptCacheStatus[i] == 1;
+}
+
 /**
  * Get the index in the container from a given label
  * @param lab Label to check
@@ -13,6 +13,8 @@ class AliVParticle;
 
 #include <TNamed.h>
 #include <TClonesArray.h>
+#include <TArrayC.h>
+#include <TArrayI.h>
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
 typedef EMCALIterableContainer::AliEmcalIterableContainerT<TObject, EMCALIterableContainer::operator_star_object<TObject> > AliEmcalIterableContainer;
@@ -151,6 +153,10 @@ class AliEmcalContainer : public TObject {
   virtual Bool_t              AcceptObject(Int_t i, UInt_t &rejectionReason) const = 0;
   virtual Bool_t              AcceptObject(const TObject* obj, UInt_t &rejectionReason) const = 0;
   Int_t                       GetNAcceptEntries() const;
+  Bool_t                      AcceptObjectCached(Int_t i, UInt_t &rejectionReason) const;
+  void                        SetUseAcceptCache(Bool_t b = kTRUE)   { fUseAcceptCache = b; ResetAcceptCache(); }
+  Bool_t                      GetUseAcceptCache()             const { return fUseAcceptCache            ; }
+  void                        ResetAcceptCache()                    { fAcceptCacheValid = kFALSE        ; }
   void                        ResetCurrentID(Int_t i=-1)            { fCurrentID = i                    ; }
   virtual void                SetArray(const AliVEvent *event);
   void                        SetArrayName(const char *n)           { fClArrayName = n                  ; }
@@ -221,11 +227,16 @@ class AliEmcalContainer : public TObject {
   Int_t                       fMaxMCLabel;              ///< maximum MC label
   Double_t                    fMassHypothesis;          ///< if < 0 it will use a PID mass when available
   Bool_t                      fIsEmbedding;             ///< if true, this container will connect to an external event
+  Bool_t                      fUseAcceptCache;          ///< if true, accept decisions are evaluated once per object and event
   TClonesArray               *fClArray;                 //!<! Pointer to array in input event
   Int_t                       fCurrentID;               //!<! current ID for automatic loops
   AliNamedArrayI             *fLabelMap;                //!<! Label-Index map
   Double_t                    fVertex[3];               //!<! event vertex array
   TClass                     *fLoadedClass;             //!<! Class of the objects contained in the TClonesArray
+  mutable Bool_t              fAcceptCacheValid;        //!<! whether the accept cache belongs to the current event
+  mutable Int_t               fNAcceptCache;            //!<! cached number of accepted objects (-1 if not yet counted)
+  mutable TArrayC             fAcceptCacheStatus;       //!<! per-object accept status (0: not evaluated, 1: accepted, 2: rejected)
+  mutable TArrayI             fAcceptCacheReason;       //!<! per-object rejection reason
 
  private:
   TString                     fClassName;               ///< name of the class in the TClonesArray
@@ -234,7 +245,7 @@ class AliEmcalContainer : public TObject {
   AliEmcalContainer& operator=(const AliEmcalContainer& other); // assignment
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalContainer,9);
+  ClassDef(AliEmcalContainer,10);
   /// \endcond
 };
 #endif
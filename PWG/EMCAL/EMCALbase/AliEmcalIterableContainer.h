@@ -328,16 +328,19 @@ T *AliEmcalIterableContainerT<T, STAR>::operator[](int index) const {
 /**
  * Build list of accepted indices inside the container.
  * For this all objects inside the container are checked
- * for being accepted or not.
+ * for being accepted or not in a single pass, using the
+ * per-event accept cache of the container if enabled.
  */
 template <typename T, typename STAR>
 void AliEmcalIterableContainerT<T, STAR>::BuildAcceptIndices(){
-  fAcceptIndices.Set(fkContainer->GetNAcceptEntries());
+  const int nentries = fkContainer->GetNEntries();
+  fAcceptIndices.Set(nentries);
   int acceptCounter = 0;
-  for(int index = 0; index < fkContainer->GetNEntries(); index++){
+  for(int index = 0; index < nentries; index++){
     UInt_t rejectionReason = 0;
-    if(fkContainer->AcceptObject(index, rejectionReason)) fAcceptIndices[acceptCounter++] = index;
+    if(fkContainer->AcceptObjectCached(index, rejectionReason)) fAcceptIndices[acceptCounter++] = index;
   }
+  fAcceptIndices.Set(acceptCounter);
 }
 
 ///////////////////////////////////////////////////////////////////////
@@ -251,9 +251,9 @@ AliVTrack* AliTrackContainer::GetTrack(Int_t i) const
  */
 AliVTrack* AliTrackContainer::GetAcceptTrack(Int_t i) const
 {
-  UInt_t rejectionReason;
+  UInt_t rejectionReason = 0;
   if (i == -1) i = fCurrentID;
-  if (AcceptTrack(i, rejectionReason)) {
+  if (fUseAcceptCache ? AcceptObjectCached(i, rejectionReason) : AcceptTrack(i, rejectionReason)) {
       return GetTrack(i);
   }
   else {
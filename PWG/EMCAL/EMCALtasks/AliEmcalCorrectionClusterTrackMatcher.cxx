@@ -3,8 +3,13 @@
 
 #include "AliEmcalCorrectionClusterTrackMatcher.h"
 
+#include <algorithm>
+
 #include <TH1.h>
 #include <TList.h>
+#include <TMath.h>
+#include <TVector2.h>
+#include <TVector3.h>
 
 #include "AliClusterContainer.h"
 #include "AliParticleContainer.h"
@@ -45,6 +50,15 @@ AliEmcalCorrectionClusterTrackMatcher::AliEmcalCorrectionClusterTrackMatcher() :
   fNEmcalClusters(0),
   fHistMatchEtaAll(0),
   fHistMatchPhiAll(0),
+  fGridNEta(0),
+  fGridNPhi(0),
+  fGridEtaMin(0),
+  fGridEtaCellSize(0),
+  fGridPhiCellSize(0),
+  fGridCellStart(),
+  fGridClusters(),
+  fGridOutside(),
+  fClusterCandidates(),
   fNMCGenerToAccept(0),
   fMCGenerToAcceptForTrack(1)
 {
@@ -369,11 +383,16 @@ void AliEmcalCorrectionClusterTrackMatcher::DoMatching()
 {
   const Double_t maxd2 = fMaxDistance*fMaxDistance;
 
+  const Bool_t useGrid = BuildClusterGrid();
+
   for (Int_t itrack = 0; itrack < fNEmcalTracks; itrack++) {
     AliEmcalParticle* emcalTrack = static_cast<AliEmcalParticle*>(fEmcalTracks->At(itrack));
     AliVTrack* track = emcalTrack->GetTrack();
 
-    for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    // Candidate clusters in increasing index order, as in the loop over all clusters
+    const Int_t ncandidates = useGrid ? GetClusterCandidates(track) : fNEmcalClusters;
+    for (Int_t icandidate = 0; icandidate < ncandidates; icandidate++) {
+      const Int_t icluster = useGrid ? fClusterCandidates[icandidate] : icandidate;
       AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
       AliVCluster* cluster = emcalCluster->GetCluster();
       
@@ -410,6 +429,113 @@ void AliEmcalCorrectionClusterTrackMatcher::DoMatching()
   }
 }
 
+/**
+ * Sort the clusters in an eta-phi grid, with cells larger than the maximum matching distance.
+ * A cluster matched to a track is then at most one cell away from the cell of the track.
+ * @return False if the grid cannot be used (no clusters, or no finite positive matching distance)
+ */
+Bool_t AliEmcalCorrectionClusterTrackMatcher::BuildClusterGrid()
+{
+  const Int_t kMaxEtaCells = 200;
+  const Double_t maxd = TMath::Abs(fMaxDistance);
+
+  fGridNEta = 0;
+  fGridNPhi = 0;
+  if (fNEmcalClusters <= 0 || !(maxd > 0) || !TMath::Finite(maxd)) return kFALSE;
+
+  // Slightly larger cells, so that rounding in the eta/phi differences cannot move a matched cluster further away
+  const Double_t cellSize = maxd * (1 + 1e-6);
+
+  // Cluster positions, as in GetEtaPhiDiff
+  std::vector<Double_t> etas(fNEmcalClusters);
+  std::vector<Double_t> phis(fNEmcalClusters);
+  Double_t etaMin = 0;
+  Double_t etaMax = 0;
+  Bool_t first = kTRUE;
+  fGridOutside.clear();
+  for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    AliEmcalParticle* emcalCluster = static_cast<AliEmcalParticle*>(fEmcalClusters->At(icluster));
+    Float_t pos[3] = {0};
+    emcalCluster->GetCluster()->GetPosition(pos);
+    TVector3 cpos(pos);
+    etas[icluster] = cpos.Eta();
+    phis[icluster] = cpos.Phi();
+    if (!TMath::Finite(etas[icluster]) || !TMath::Finite(phis[icluster])) {
+      fGridOutside.push_back(icluster);
+      continue;
+    }
+    if (first || etas[icluster] < etaMin) etaMin = etas[icluster];
+    if (first || etas[icluster] > etaMax) etaMax = etas[icluster];
+    first = kFALSE;
+  }
+
+  fGridEtaMin = etaMin;
+  fGridEtaCellSize = TMath::Max(cellSize, (etaMax - etaMin) / (kMaxEtaCells - 1));
+  if (!TMath::Finite(fGridEtaCellSize)) return kFALSE;
+  fGridNEta = Int_t((etaMax - etaMin) / fGridEtaCellSize) + 1;
+  fGridNPhi = TMath::Max(1, Int_t(TMath::TwoPi() / cellSize));
+  fGridPhiCellSize = TMath::TwoPi() / fGridNPhi;
+
+  // Clusters sorted by cell, in increasing index order within a cell
+  const Int_t ncells = fGridNEta * fGridNPhi;
+  std::vector<Int_t> cellOfCluster(fNEmcalClusters, -1);
+  fGridCellStart.assign(ncells + 1, 0);
+  for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    if (!TMath::Finite(etas[icluster]) || !TMath::Finite(phis[icluster])) continue;
+    Int_t ieta = TMath::Min(fGridNEta - 1, TMath::Max(0, Int_t((etas[icluster] - fGridEtaMin) / fGridEtaCellSize)));
+    Int_t iphi = TMath::Min(fGridNPhi - 1, TMath::Max(0, Int_t((phis[icluster] + TMath::Pi()) / fGridPhiCellSize)));
+    cellOfCluster[icluster] = ieta * fGridNPhi + iphi;
+    fGridCellStart[cellOfCluster[icluster] + 1]++;
+  }
+  for (Int_t icell = 0; icell < ncells; icell++) fGridCellStart[icell + 1] += fGridCellStart[icell];
+  fGridClusters.resize(fGridCellStart[ncells]);
+  std::vector<Int_t> fill(fGridCellStart.begin(), fGridCellStart.end() - 1);
+  for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) {
+    if (cellOfCluster[icluster] < 0) continue;
+    fGridClusters[fill[cellOfCluster[icluster]]++] = icluster;
+  }
+
+  return kTRUE;
+}
+
+/**
+ * Collect the clusters of the grid cells adjacent to the track position on the EMCal surface.
+ * Tracks with undefined eta/phi are compared to all clusters.
+ * @param[in] track Track to be matched
+ * @return Number of candidate clusters in fClusterCandidates, in increasing index order
+ */
+Int_t AliEmcalCorrectionClusterTrackMatcher::GetClusterCandidates(const AliVTrack* track)
+{
+  fClusterCandidates.clear();
+
+  Double_t veta = track->GetTrackEtaOnEMCal();
+  Double_t vphi = track->GetTrackPhiOnEMCal();
+  if (!TMath::Finite(veta) || !TMath::Finite(vphi)) {
+    for (Int_t icluster = 0; icluster < fNEmcalClusters; icluster++) fClusterCandidates.push_back(icluster);
+    return fNEmcalClusters;
+  }
+
+  Double_t teta = TMath::Floor((veta - fGridEtaMin) / fGridEtaCellSize);
+  if (teta >= -1 && teta <= fGridNEta) {
+    Int_t etaFirst = TMath::Max(0, Int_t(teta) - 1);
+    Int_t etaLast = TMath::Min(fGridNEta - 1, Int_t(teta) + 1);
+    Int_t iphiTrack = Int_t(TMath::Floor((TVector2::Phi_mpi_pi(vphi) + TMath::Pi()) / fGridPhiCellSize));
+    Int_t nphi = fGridNPhi > 3 ? 3 : fGridNPhi;
+    for (Int_t ieta = etaFirst; ieta <= etaLast; ieta++) {
+      for (Int_t i = 0; i < nphi; i++) {
+        Int_t iphi = fGridNPhi > 3 ? iphiTrack - 1 + i : i;
+        iphi = ((iphi % fGridNPhi) + fGridNPhi) % fGridNPhi;
+        Int_t icell = ieta * fGridNPhi + iphi;
+        for (Int_t j = fGridCellStart[icell]; j < fGridCellStart[icell + 1]; j++) fClusterCandidates.push_back(fGridClusters[j]);
+      }
+    }
+  }
+  fClusterCandidates.insert(fClusterCandidates.end(), fGridOutside.begin(), fGridOutside.end());
+  std::sort(fClusterCandidates.begin(), fClusterCandidates.end());
+
+  return fClusterCandidates.size();
+}
+
 /**
  * Update clusters with matching info.
  */
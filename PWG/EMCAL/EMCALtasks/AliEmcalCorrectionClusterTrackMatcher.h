@@ -1,6 +1,8 @@
 #ifndef ALIEMCALCORRECTIONCLUSTERTRACKMATCHER_H
 #define ALIEMCALCORRECTIONCLUSTERTRACKMATCHER_H
 
+#include <vector>
+
 #include "AliEmcalCorrectionComponent.h"
 
 #if !(defined(__CINT__) || defined(__MAKECINT__))
@@ -11,6 +13,7 @@ class TH1;
 class TClonesArray;
 
 class AliVParticle;
+class AliVTrack;
 
 /**
  * @class AliEmcalCorrectionClusterTrackMatcher
@@ -45,6 +48,11 @@ class AliVParticle;
  ~~~
  (again assuming that the task is derived from AliAnalysisTaskEmcal or AliAnalysisTaskEmcalJet).
  *
+ * To avoid testing every track-cluster pair, the clusters are sorted in an \f$\eta\f$-\f$\phi\f$ grid with cells
+ * larger than the maximum matching distance (with \f$\phi\f$ wrap-around), and each track is only compared to the
+ * clusters of the adjacent cells. The pairs are tested in the same order as with the full loop, therefore the matching
+ * information is identical.
+ *
  * Based on code in AliEmcalClusTrackMatcherTask. 
  *
  * @author Constantin Loizides, LBNL, AliEmcalClusTrackMatcherTask
@@ -69,6 +77,8 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   Int_t         GetMomBin(Double_t p) const;
   void          GenerateEmcalParticles();
   void          DoMatching();
+  Bool_t        BuildClusterGrid();
+  Int_t         GetClusterCandidates(const AliVTrack* track);
   void          UpdateTracks();
   void          UpdateClusters();
   Bool_t        IsTrackInEmcalAcceptance(AliVParticle* part, Double_t edges=0.9) const;
@@ -102,6 +112,16 @@ class AliEmcalCorrectionClusterTrackMatcher : public AliEmcalCorrectionComponent
   TH1          *fHistMatchPhiAll;       //!<!dphi distribution
   TH1          *fHistMatchEta[10][9][2]; //!<!deta distribution
   TH1          *fHistMatchPhi[10][9][2]; //!<!dphi distribution
+
+  Int_t         fGridNEta;              //!<!number of eta cells of the cluster grid
+  Int_t         fGridNPhi;              //!<!number of phi cells of the cluster grid
+  Double_t      fGridEtaMin;            //!<!lower eta edge of the cluster grid
+  Double_t      fGridEtaCellSize;       //!<!eta size of the cluster grid cells
+  Double_t      fGridPhiCellSize;       //!<!phi size of the cluster grid cells
+  std::vector<Int_t> fGridCellStart;    //!<!first entry of each cell in fGridClusters
+  std::vector<Int_t> fGridClusters;     //!<!cluster indices sorted by cell
+  std::vector<Int_t> fGridOutside;      //!<!clusters with undefined eta/phi, tested with every track
+  std::vector<Int_t> fClusterCandidates; //!<!candidate clusters of the current track
   
   Int_t      fNMCGenerToAccept;          ///<  Number of MC generators that should not be included in analysis
   TString    fMCGenerToAccept[5];        ///<  List with name of generators that should not be included
@@ -115,7 +135,7 @@ private:
   static RegisterCorrectionComponent<AliEmcalCorrectionClusterTrackMatcher> reg;
 
   /// \cond CLASSIMP
-  ClassDef(AliEmcalCorrectionClusterTrackMatcher, 4); // EMCal cluster track matcher correction component
+  ClassDef(AliEmcalCorrectionClusterTrackMatcher, 5); // EMCal cluster track matcher correction component
   /// \endcond
 };
 
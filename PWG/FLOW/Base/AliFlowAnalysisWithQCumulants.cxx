@@ -134,6 +134,7 @@ AliFlowAnalysisWithQCumulants::AliFlowAnalysisWithQCumulants():
  fUse2DHistograms(kFALSE),
  fFillProfilesVsMUsingWeights(kTRUE),
  fUseQvectorTerms(kFALSE),
+ fUseQvectorRecurrence(kFALSE),
  fReQ(NULL),
  fImQ(NULL),
  fSpk(NULL),
@@ -376,6 +377,12 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  if(fStoreControlHistograms){this->FillControlHistograms(anEvent);}                                                              
                                                                                                                                                                                                                                                                                         
  // d) Loop over data and calculate e-b-e quantities Q_{n,k}, S_{p,k} and s_{p,k}:
+ if(fUseQvectorRecurrence)
+ {
+  this->CalculateQvectorsWithRecurrence(anEvent);
+  this->CalculateCorrelationsFromQvectors(anEvent);
+  return;
+ }
  Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks
  AliFlowTrackSimple *aftsTrack = NULL;
  Int_t n = fHarmonic; // shortcut for the harmonic 
@@ -548,6 +555,16 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
     }
  } // end of for(Int_t i=0;i<nPrim;i++) 
 
+ this->CalculateCorrelationsFromQvectors(anEvent);
+
+} // end of AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateCorrelationsFromQvectors(AliFlowEventSimple* anEvent)
+{
+ // Steps e) - n) of Make(), once the e-b-e quantities are filled by the loop over data or by CalculateQvectorsWithRecurrence().
+
  // e) Calculate the final expressions for S_{p,k} and s_{p,k} (important !!!!):
  for(Int_t p=0;p<8;p++)
  {
@@ -696,7 +713,358 @@ void AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
  // n) Reset all event-by-event quantities (very important !!!!):
  this->ResetEventByEventQuantities();
  
-} // end of AliFlowAnalysisWithQCumulants::Make(AliFlowEventSimple* anEvent)
+} // end of void AliFlowAnalysisWithQCumulants::CalculateCorrelationsFromQvectors(AliFlowEventSimple* anEvent)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateQvectorsWithRecurrence(AliFlowEventSimple *anEvent)
+{
+ // Calculate e-b-e quantities Q_{n,k}, S_{p,k} and s_{p,k}, r_{m*n,k}, p_{m*n,k} and q_{m*n,k} (the same as the loop over data in Make()).
+
+ // a) Copy kinematics and particle weights of RPs and POIs into arrays;
+ // b) Reference flow: Q_{m*n,k} and S_{p,k} in batches of tracks;
+ // c) Differential flow: accumulate r_{m*n,k}, p_{m*n,k}, q_{m*n,k} and s_{1,k} per bin in batches of tracks; 
+ // d) Fill the e-b-e profiles once from the per-bin sums.
+
+ // Remarks: 
+ //  1.) cos(m*n*phi) and sin(m*n*phi) are obtained from cos(n*phi) and sin(n*phi) by complex multiplication, 
+ //      and w^k by running products, so they agree with TMath::Cos(), TMath::Sin() and pow() only up to rounding;
+ //  2.) tracks are summed in the same order as in Make(), so apart from 1.) Q-vectors and bin contents/entries of e-b-e profiles are unchanged;
+ //  3.) bin errors of e-b-e profiles are not filled (they are not used anywhere).
+
+ const Int_t nBatch = 64; // number of tracks processed in one batch 
+ Double_t cosmn[12*nBatch]; // cos(m*n*phi) for a batch of tracks, [m*nBatch+i] 
+ Double_t sinmn[12*nBatch]; // sin(m*n*phi) for a batch of tracks, [m*nBatch+i]
+ Double_t wk[9*nBatch]; // w^k for a batch of tracks, [k*nBatch+i]
+
+ // a) Copy kinematics and particle weights of RPs and POIs into arrays:
+ Int_t nPrim = anEvent->NumberOfTracks();  // nPrim = total number of primary tracks
+ if(fQvecPhi[0].GetSize()<nPrim)
+ {
+  for(Int_t rp=0;rp<2;rp++) // [0=RP,1=POI]
+  {
+   fQvecPhi[rp].Set(nPrim);
+   fQvecPt[rp].Set(nPrim);
+   fQvecEta[rp].Set(nPrim);
+   fQvecWeight[rp].Set(nPrim);
+  }
+  fQvecIsRPandPOI.Set(nPrim);
+ } // end of if(fQvecPhi[0].GetSize()<nPrim)
+ Double_t dPhi = 0.; // azimuthal angle in the laboratory frame
+ Double_t dPt  = 0.; // transverse momentum
+ Double_t dEta = 0.; // pseudorapidity
+ Double_t wPhi = 1.; // phi weight
+ Double_t wPt  = 1.; // pt weight
+ Double_t wEta = 1.; // eta weight
+ Double_t wTrack = 1.; // track weight
+ Int_t nCounterNoRPs = 0; // needed only for shuffling
+ Int_t nRPs = 0; // number of RPs stored in arrays
+ Int_t nPOIs = 0; // number of POIs stored in arrays
+ AliFlowTrackSimple *aftsTrack = NULL;
+ for(Int_t i=0;i<nPrim;i++) 
+ { 
+  if(fExactNoRPs > 0 && nCounterNoRPs>fExactNoRPs){continue;}
+  aftsTrack=anEvent->GetTrack(i);
+  if(!aftsTrack)
+  {
+   printf("\n WARNING (QC): No particle (i.e. aftsTrack is a NULL pointer in AFAWQC::Make())!!!!\n\n");
+   continue;
+  }
+  if(!(aftsTrack->InRPSelection() || aftsTrack->InPOISelection())){continue;} // safety measure: consider only tracks which are RPs or POIs
+  if(aftsTrack->InRPSelection()) // RP condition:
+  {    
+   nCounterNoRPs++;
+   dPhi = aftsTrack->Phi();
+   dPt  = aftsTrack->Pt();
+   dEta = aftsTrack->Eta();
+   if(fUsePhiWeights && fPhiWeights && fnBinsPhi) // determine phi weight for this particle:
+   {
+    wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
+   }
+   if(fUsePtWeights && fPtWeights && fnBinsPt) // determine pt weight for this particle:
+   {
+    wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
+   }              
+   if(fUseEtaWeights && fEtaWeights && fEtaBinWidth) // determine eta weight for this particle: 
+   {
+    wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
+   }      
+   if(fUseTrackWeights)
+   {
+    wTrack = aftsTrack->Weight(); 
+   }
+   fQvecPhi[0][nRPs] = dPhi;
+   fQvecPt[0][nRPs] = dPt;
+   fQvecEta[0][nRPs] = dEta;
+   fQvecWeight[0][nRPs] = wPhi*wPt*wEta*wTrack;
+   fQvecIsRPandPOI[nRPs] = (Int_t)aftsTrack->InPOISelection();
+   nRPs++;
+  } // end of if(aftsTrack->InRPSelection())
+  if(aftsTrack->InPOISelection())
+  {
+   dPhi = aftsTrack->Phi();
+   dPt  = aftsTrack->Pt();
+   dEta = aftsTrack->Eta();
+   wPhi = 1.;
+   wPt  = 1.;
+   wEta = 1.;
+   wTrack = 1.;
+   if(fUsePhiWeights && fPhiWeights && fnBinsPhi && aftsTrack->InRPSelection()) // determine phi weight for POI && RP particle:
+   {
+    wPhi = fPhiWeights->GetBinContent(1+(Int_t)(TMath::Floor(dPhi*fnBinsPhi/TMath::TwoPi())));
+   }
+   if(fUsePtWeights && fPtWeights && fnBinsPt && aftsTrack->InRPSelection()) // determine pt weight for POI && RP particle:
+   {
+    wPt = fPtWeights->GetBinContent(1+(Int_t)(TMath::Floor((dPt-fPtMin)/fPtBinWidth))); 
+   }              
+   if(fUseEtaWeights && fEtaWeights && fEtaBinWidth && aftsTrack->InRPSelection()) // determine eta weight for POI && RP particle: 
+   {
+    wEta = fEtaWeights->GetBinContent(1+(Int_t)(TMath::Floor((dEta-fEtaMin)/fEtaBinWidth))); 
+   }      
+   if(aftsTrack->InRPSelection() && fUseTrackWeights)
+   {
+    wTrack = aftsTrack->Weight(); 
+   }
+   fQvecPhi[1][nPOIs] = dPhi;
+   fQvecPt[1][nPOIs] = dPt;
+   fQvecEta[1][nPOIs] = dEta;
+   fQvecWeight[1][nPOIs] = wPhi*wPt*wEta*wTrack;
+   nPOIs++;
+  } // end of if(aftsTrack->InPOISelection())
+ } // end of for(Int_t i=0;i<nPrim;i++) 
+
+ // Number of cells (including underflow and overflow) in e-b-e profiles for differential flow:
+ const Int_t nStride = 2*4*9+9+1; // per bin: Re[m][k], Im[m][k], s[k] and number of entries
+ Int_t nCells[9] = {0};
+ for(Int_t t=0;t<3;t++) // typeFlag (0 = RP, 1 = POI, 2 = RP && POI )
+ {
+  if(fCalculateDiffFlow)
+  {
+   for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+   {
+    nCells[2*t+pe] = fReRPQ1dEBE[t][pe][0][0]->GetNbinsX()+2;
+   }
+  }
+  if(fCalculate2DDiffFlow)
+  {
+   nCells[6+t] = (fReRPQ2dEBE[t][0][0]->GetNbinsX()+2)*(fReRPQ2dEBE[t][0][0]->GetNbinsY()+2);
+  }
+ }
+ for(Int_t a=0;a<9;a++) // [2*t+pe for 1D, 6+t for 2D]
+ {
+  if(fQvecDiffSums[a].GetSize()<nCells[a]*nStride)
+  {
+   fQvecDiffSums[a].Set(nCells[a]*nStride);
+   fQvecDiffBins[a].Set(nCells[a]);
+  }
+ }
+
+ // b) Reference flow: Q_{m*n,k} and S_{p,k} from RPs in batches of tracks,
+ // c) Differential flow: r_{m*n,k} and q_{m*n,k} from RPs, p_{m*n,k} from POIs in batches of tracks:
+ Bool_t bDiffFlow = (fCalculateDiffFlow || fCalculate2DDiffFlow);
+ Double_t dReQ[12][9] = {{0.}}; // Re[Q_{m*n,k}]
+ Double_t dImQ[12][9] = {{0.}}; // Im[Q_{m*n,k}]
+ Double_t dS[9] = {0.}; // sum_{i=1}^{M} w_{i}^{k}
+ for(Int_t rp=0;rp<2;rp++) // [0=RP,1=POI]
+ {
+  if(1==rp && !bDiffFlow){break;} // POIs are needed only for differential flow 
+  Int_t nTracks = (0==rp ? nRPs : nPOIs);
+  Int_t nHarmonics = (0==rp ? 12 : 4); // 12 for Q_{m*n,k}, 4 for differential flow
+  for(Int_t b=0;b<nTracks;b+=nBatch)
+  {
+   Int_t nb = TMath::Min(nBatch,nTracks-b);
+   this->CalculateHarmonicsAndWeightPowers(&fQvecPhi[rp].GetArray()[b],&fQvecWeight[rp].GetArray()[b],nb,nHarmonics,nBatch,cosmn,sinmn,wk);
+   if(0==rp) // reference flow
+   {
+    for(Int_t m=0;m<12;m++) 
+    {
+     const Double_t *cosm = &cosmn[m*nBatch];
+     const Double_t *sinm = &sinmn[m*nBatch];
+     for(Int_t k=0;k<9;k++) 
+     {
+      const Double_t *wpow = &wk[k*nBatch];
+      Double_t dRe = dReQ[m][k];
+      Double_t dIm = dImQ[m][k];
+      for(Int_t i=0;i<nb;i++)
+      {
+       dRe+=wpow[i]*cosm[i]; 
+       dIm+=wpow[i]*sinm[i]; 
+      }
+      dReQ[m][k] = dRe;
+      dImQ[m][k] = dIm;
+     } 
+    }
+    for(Int_t k=0;k<9;k++)
+    {
+     const Double_t *wpow = &wk[k*nBatch];
+     for(Int_t i=0;i<nb;i++)
+     {
+      dS[k]+=wpow[i];
+     }
+    } 
+   } // end of if(0==rp) // reference flow 
+   if(!bDiffFlow){continue;} 
+   for(Int_t i=0;i<nb;i++)
+   {
+    Double_t ptEta[2] = {fQvecPt[rp][b+i],fQvecEta[rp][b+i]}; // 0 = dPt, 1 = dEta
+    // typeFlag t is 0 for RP and 1 for POI, and in addition 2 for RP which is also POI:
+    Int_t nTypes = (0==rp && fQvecIsRPandPOI[b+i]) ? 2 : 1;
+    for(Int_t tt=0;tt<nTypes;tt++)
+    {
+     Int_t t = (0==tt ? rp : 2);
+     if(fCalculateDiffFlow)
+     {
+      for(Int_t pe=0;pe<1+(Int_t)fCalculateDiffFlowVsEta;pe++) // pt or eta
+      {
+       this->AccumulateDiffFlowBin(2*t+pe,fReRPQ1dEBE[t][pe][0][0]->GetXaxis()->FindBin(ptEta[pe]),i,nBatch,cosmn,sinmn,wk);
+      }
+     }
+     if(fCalculate2DDiffFlow)
+     {
+      this->AccumulateDiffFlowBin(6+t,fReRPQ2dEBE[t][0][0]->FindBin(ptEta[0],ptEta[1]),i,nBatch,cosmn,sinmn,wk);
+     }
+    } // end of for(Int_t tt=0;tt<nTypes;tt++)
+   } // end of for(Int_t i=0;i<nb;i++)
+  } // end of for(Int_t b=0;b<nTracks;b+=nBatch)
+ } // end of for(Int_t rp=0;rp<2;rp++) // [0=RP,1=POI]
+ for(Int_t m=0;m<12;m++) 
+ {
+  for(Int_t k=0;k<9;k++) 
+  {
+   (*fReQ)(m,k)+=dReQ[m][k]; 
+   (*fImQ)(m,k)+=dImQ[m][k]; 
+  } 
+ }
+ for(Int_t p=0;p<8;p++)
+ {
+  for(Int_t k=0;k<9;k++)
+  {     
+   (*fSpk)(p,k)+=dS[k];
+  }
+ } 
+
+ // d) Fill the e-b-e profiles once from the per-bin sums:
+ for(Int_t a=0;a<9;a++) // [2*t+pe for 1D, 6+t for 2D]
+ {
+  Int_t t = (a<6 ? a/2 : a-6); 
+  Int_t pe = a%2; 
+  for(Int_t bb=0;bb<fQvecDiffNBins[a];bb++)
+  {
+   Int_t bin = fQvecDiffBins[a][bb];
+   Double_t *sums = &fQvecDiffSums[a].GetArray()[bin*nStride];
+   Double_t dEntries = sums[nStride-1];
+   for(Int_t m=0;m<4;m++) 
+   {
+    for(Int_t k=0;k<9;k++) 
+    {
+     if(a<6)
+     {
+      fReRPQ1dEBE[t][pe][m][k]->SetBinContent(bin,sums[m*9+k]);
+      fReRPQ1dEBE[t][pe][m][k]->SetBinEntries(bin,dEntries);
+      fImRPQ1dEBE[t][pe][m][k]->SetBinContent(bin,sums[36+m*9+k]);
+      fImRPQ1dEBE[t][pe][m][k]->SetBinEntries(bin,dEntries);
+     } else
+       {
+        fReRPQ2dEBE[t][m][k]->SetBinContent(bin,sums[m*9+k]);
+        fReRPQ2dEBE[t][m][k]->SetBinEntries(bin,dEntries);
+        fImRPQ2dEBE[t][m][k]->SetBinContent(bin,sums[36+m*9+k]);
+        fImRPQ2dEBE[t][m][k]->SetBinEntries(bin,dEntries);
+       }
+    }
+   }
+   if(1!=t) // s_{p,k} is not needed for POIs
+   {
+    for(Int_t k=0;k<9;k++) 
+    {
+     if(a<6)
+     {
+      fs1dEBE[t][pe][k]->SetBinContent(bin,sums[72+k]);
+      fs1dEBE[t][pe][k]->SetBinEntries(bin,dEntries);
+     } else
+       {
+        fs2dEBE[t][k]->SetBinContent(bin,sums[72+k]);
+        fs2dEBE[t][k]->SetBinEntries(bin,dEntries);
+       }
+    }
+   }
+   for(Int_t s=0;s<nStride;s++)
+   {
+    sums[s] = 0.;
+   } 
+  } // end of for(Int_t bb=0;bb<fQvecDiffNBins[a];bb++)
+  fQvecDiffNBins[a] = 0;
+ } // end of for(Int_t a=0;a<9;a++)
+
+} // end of void AliFlowAnalysisWithQCumulants::CalculateQvectorsWithRecurrence(AliFlowEventSimple *anEvent)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::CalculateHarmonicsAndWeightPowers(const Double_t *phi, const Double_t *w, Int_t nTracks, Int_t nHarmonics, Int_t nStride, Double_t *cosmn, Double_t *sinmn, Double_t *wk)
+{
+ // For nTracks tracks calculate cos(m*n*phi) and sin(m*n*phi) for m = 1,...,nHarmonics and w^k for k = 0,...,8.
+ // Results are stored as cosmn[(m-1)*nStride+i], sinmn[(m-1)*nStride+i] and wk[k*nStride+i]. 
+
+ Int_t n = fHarmonic; // shortcut for the harmonic 
+ for(Int_t i=0;i<nTracks;i++)
+ {
+  cosmn[i] = TMath::Cos(n*phi[i]);
+  sinmn[i] = TMath::Sin(n*phi[i]);
+  wk[i] = 1.;
+ }
+ // cos((m+1)*n*phi) + i sin((m+1)*n*phi) = [cos(m*n*phi) + i sin(m*n*phi)] * [cos(n*phi) + i sin(n*phi)]: 
+ for(Int_t m=1;m<nHarmonics;m++)
+ {
+  Double_t *cosm = &cosmn[m*nStride];
+  Double_t *sinm = &sinmn[m*nStride];
+  const Double_t *cosm1 = &cosmn[(m-1)*nStride];
+  const Double_t *sinm1 = &sinmn[(m-1)*nStride];
+  for(Int_t i=0;i<nTracks;i++)
+  {
+   cosm[i] = cosm1[i]*cosmn[i]-sinm1[i]*sinmn[i];
+   sinm[i] = sinm1[i]*cosmn[i]+cosm1[i]*sinmn[i];
+  }
+ }
+ // w^k = w^{k-1} * w:
+ for(Int_t k=1;k<9;k++)
+ {
+  Double_t *wpow = &wk[k*nStride];
+  const Double_t *wpow1 = &wk[(k-1)*nStride];
+  for(Int_t i=0;i<nTracks;i++)
+  {
+   wpow[i] = wpow1[i]*w[i];
+  }
+ }
+
+} // end of void AliFlowAnalysisWithQCumulants::CalculateHarmonicsAndWeightPowers(...)
+
+//=======================================================================================================================
+
+void AliFlowAnalysisWithQCumulants::AccumulateDiffFlowBin(Int_t a, Int_t bin, Int_t i, Int_t nStride, const Double_t *cosmn, const Double_t *sinmn, const Double_t *wk)
+{
+ // Add the i-th track of the current batch (see CalculateHarmonicsAndWeightPowers) to the per-bin sums fQvecDiffSums[a] 
+ // of Re and Im of r_{m*n,k}, p_{m*n,k} or q_{m*n,k} (m = 1,...,4), of s_{1,k} and of the number of entries.
+
+ const Int_t nSums = 2*4*9+9+1; 
+ Double_t *sums = &fQvecDiffSums[a].GetArray()[bin*nSums];
+ if(0.==sums[nSums-1]) // first track in this bin
+ {
+  fQvecDiffBins[a][fQvecDiffNBins[a]++] = bin;
+ }
+ for(Int_t m=0;m<4;m++) 
+ {
+  for(Int_t k=0;k<9;k++) 
+  {
+   sums[m*9+k]+=wk[k*nStride+i]*cosmn[m*nStride+i];
+   sums[36+m*9+k]+=wk[k*nStride+i]*sinmn[m*nStride+i];
+  }
+ }
+ for(Int_t k=0;k<9;k++) 
+ {
+  sums[72+k]+=wk[k*nStride+i];
+ }
+ sums[nSums-1]+=1.;
+
+} // end of void AliFlowAnalysisWithQCumulants::AccumulateDiffFlowBin(...)
 
 //=======================================================================================================================
 
@@ -15381,6 +15749,11 @@ void AliFlowAnalysisWithQCumulants::InitializeArraysForDiffFlow()
    }   
   }
  }
+ // Per-bin sums used by CalculateQvectorsWithRecurrence():
+ for(Int_t a=0;a<9;a++) // [2*t+pe for 1D, 6+t for 2D]
+ {
+  fQvecDiffNBins[a] = 0;
+ }
  
  // d) Initialize profiles:
  for(Int_t t=0;t<2;t++) // type: RP or POI
@@ -15,6 +15,8 @@
 #define ALIFLOWANALYSISWITHQCUMULANTS_H
 
 #include "TMatrixD.h"
+#include "TArrayD.h"
+#include "TArrayI.h"
 #include "TH2D.h"
 #include "TRandom3.h"
 #include "AliFlowCommonConstants.h"
@@ -82,6 +84,10 @@ class AliFlowAnalysisWithQCumulants{
     virtual void FillCommonControlHistograms(AliFlowEventSimple *anEvent);
     virtual void FillControlHistograms(AliFlowEventSimple *anEvent);
     virtual void ResetEventByEventQuantities();
+    virtual void CalculateQvectorsWithRecurrence(AliFlowEventSimple *anEvent);
+    virtual void CalculateCorrelationsFromQvectors(AliFlowEventSimple *anEvent);
+    virtual void CalculateHarmonicsAndWeightPowers(const Double_t *phi, const Double_t *w, Int_t nTracks, Int_t nHarmonics, Int_t nStride, Double_t *cosmn, Double_t *sinmn, Double_t *wk);
+    virtual void AccumulateDiffFlowBin(Int_t a, Int_t bin, Int_t i, Int_t nStride, const Double_t *cosmn, const Double_t *sinmn, const Double_t *wk);
     // 2b.) Reference flow:
     virtual void CalculateIntFlowCorrelations(); 
     virtual void CalculateIntFlowCorrelationsUsingParticleWeights();
@@ -287,6 +293,8 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t GetFillProfilesVsMUsingWeights() const {return this->fFillProfilesVsMUsingWeights;};
   void SetUseQvectorTerms(Bool_t const uqvt){this->fUseQvectorTerms = uqvt;if(uqvt){this->fStoreControlHistograms = kTRUE;}};
   Bool_t GetUseQvectorTerms() const {return this->fUseQvectorTerms;};
+  void SetUseQvectorRecurrence(Bool_t const uqvr){this->fUseQvectorRecurrence = uqvr;};
+  Bool_t GetUseQvectorRecurrence() const {return this->fUseQvectorRecurrence;};
 
   // Reference flow profiles:
   void SetAvMultiplicity(TProfile* const avMultiplicity) {this->fAvMultiplicity = avMultiplicity;};
@@ -627,11 +635,20 @@ class AliFlowAnalysisWithQCumulants{
   Bool_t fUse2DHistograms; // use TH2D instead of TProfile to improve numerical stability in reference flow calculation 
   Bool_t fFillProfilesVsMUsingWeights; // if the width of multiplicity bin is 1, weights are not needed  
   Bool_t fUseQvectorTerms; // use TH2D with separate Q-vector terms instead of TProfile to improve numerical stability in reference flow calculation 
+  Bool_t fUseQvectorRecurrence; // calculate e-b-e Q-vectors with multiple-angle recurrence and running products of weights (see CalculateQvectorsWithRecurrence) 
 
   //  3c.) event-by-event quantities:
   TMatrixD *fReQ; //! fReQ[m][k] = sum_{i=1}^{M} w_{i}^{k} cos(m*phi_{i})
   TMatrixD *fImQ; //! fImQ[m][k] = sum_{i=1}^{M} w_{i}^{k} sin(m*phi_{i})
   TMatrixD *fSpk; //! fSM[p][k] = (sum_{i=1}^{M} w_{i}^{k})^{p+1}
+  TArrayD fQvecPhi[2]; //! phi of [0=RP,1=POI] in current event, used by CalculateQvectorsWithRecurrence
+  TArrayD fQvecPt[2]; //! pt of [0=RP,1=POI] in current event
+  TArrayD fQvecEta[2]; //! eta of [0=RP,1=POI] in current event
+  TArrayD fQvecWeight[2]; //! product of particle weights of [0=RP,1=POI] in current event
+  TArrayI fQvecIsRPandPOI; //! 1 if RP is also POI
+  TArrayD fQvecDiffSums[9]; //! [2*t+pe for 1D, 6+t for 2D] per-bin sums of r_{m*n,k}, p_{m*n,k}, q_{m*n,k} and s_{1,k} 
+  TArrayI fQvecDiffBins[9]; //! bins touched in current event (only they are filled and cleared)
+  Int_t fQvecDiffNBins[9]; //! number of bins touched in current event
   TH1D *fIntFlowCorrelationsEBE; // 1st bin: <2>, 2nd bin: <4>, 3rd bin: <6>, 4th bin: <8>
   TH1D *fIntFlowEventWeightsForCorrelationsEBE; // 1st bin: eW_<2>, 2nd bin: eW_<4>, 3rd bin: eW_<6>, 4th bin: eW_<8>
   TH1D *fIntFlowCorrelationsAllEBE; // to be improved (add comment)
@@ -847,7 +864,7 @@ class AliFlowAnalysisWithQCumulants{
   TH2D *fBootstrapCumulants; // x-axis => QC{2}, QC{4}, QC{6}, QC{8}; y-axis => subsample # 
   TH2D *fBootstrapCumulantsVsM[4]; // index => QC{2}, QC{4}, QC{6}, QC{8}; x-axis => multiplicity; y-axis => subsample # 
 
-  ClassDef(AliFlowAnalysisWithQCumulants, 4);
+  ClassDef(AliFlowAnalysisWithQCumulants, 5);
 
 };
 
@@ -87,6 +87,14 @@ AliFlowEventSimple::AliFlowEventSimple():
   fZPCM(0.),
   fZPAM(0.),
   fAbsOrbit(0),
+  fUseHarmonicCache(kFALSE),
+  fHarmonicCacheFilled(kFALSE),
+  fHarmonicCacheNTracks(0),
+  fCachePhi(),
+  fCachePt(),
+  fCacheEta(),
+  fCacheWeight(),
+  fCacheFlags(),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(NULL)
 {
@@ -146,6 +154,14 @@ AliFlowEventSimple::AliFlowEventSimple( Int_t n,
   fZPCM(0.),
   fZPAM(0.),
   fAbsOrbit(0),
+  fUseHarmonicCache(kFALSE),
+  fHarmonicCacheFilled(kFALSE),
+  fHarmonicCacheNTracks(0),
+  fCachePhi(),
+  fCachePt(),
+  fCacheEta(),
+  fCacheWeight(),
+  fCacheFlags(),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -209,6 +225,14 @@ AliFlowEventSimple::AliFlowEventSimple(const AliFlowEventSimple& anEvent):
   fZPCM(anEvent.fZPCM),
   fZPAM(anEvent.fZPAM),
   fAbsOrbit(anEvent.fAbsOrbit),
+  fUseHarmonicCache(anEvent.fUseHarmonicCache),
+  fHarmonicCacheFilled(kFALSE),
+  fHarmonicCacheNTracks(0),
+  fCachePhi(),
+  fCachePt(),
+  fCacheEta(),
+  fCacheWeight(),
+  fCacheFlags(),
   fNumberOfPOItypes(anEvent.fNumberOfPOItypes),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -298,6 +322,8 @@ AliFlowEventSimple& AliFlowEventSimple::operator=(const AliFlowEventSimple& anEv
   fZPCM = anEvent.fZPCM;
   fZPAM = anEvent.fZPAM;
   fAbsOrbit = anEvent.fAbsOrbit;
+  fUseHarmonicCache = anEvent.fUseHarmonicCache;
+  InvalidateHarmonicCache();
   for(Int_t i(0); i < 3; i++) {
     fVtxPos[i] = anEvent.fVtxPos[i];
   }
@@ -466,6 +492,7 @@ void AliFlowEventSimple::AddTrack( AliFlowTrackSimple* track )
 void AliFlowEventSimple::TrackAdded()
 {
   //book keeping after a new track has been added
+  InvalidateHarmonicCache();
   fNumberOfTracks++;
   if (fShuffledIndexes)
   {
@@ -493,6 +520,12 @@ AliFlowVector AliFlowEventSimple::GetQ( Int_t n,
                                         Bool_t useEtaWeights )
 {
   // calculate Q-vector in harmonic n without weights (default harmonic n=2)
+  // without phi/pt/eta weights it is taken from the harmonic cache, if enabled
+  if(fUseHarmonicCache && !(weightsList && (usePhiWeights || usePtWeights || useEtaWeights)))
+  {
+    return GetCacheQ(n,-1);
+  }
+
   Double_t dQX = 0.;
   Double_t dQY = 0.;
   AliFlowVector vQ;
@@ -612,6 +645,21 @@ void AliFlowEventSimple::Get2Qsub( AliFlowVector* Qarray,
 {
 
   // calculate Q-vector in harmonic n without weights (default harmonic n=2)
+  // without phi/pt/eta weights they are taken from the harmonic cache, if enabled
+  if(fUseHarmonicCache && !(weightsList && (usePhiWeights || usePtWeights || useEtaWeights)))
+  {
+    for (Int_t s=0; s<2; s++)
+    {
+      AliFlowVector vQ = GetCacheQ(n,s);
+      Qarray[s].Set(vQ.X(),vQ.Y());
+      Qarray[s].SetMult(vQ.GetMult());
+      Qarray[s].SetHarmonic(n);
+      Qarray[s].SetPOItype(AliFlowTrackSimple::kRP);
+      Qarray[s].SetSubeventNumber(s);
+    }
+    return;
+  }
+
   Double_t dQX = 0.;
   Double_t dQY = 0.;
 
@@ -748,6 +796,142 @@ void AliFlowEventSimple::Get2Qsub( AliFlowVector* Qarray,
 
 }
 
+//-----------------------------------------------------------------------
+void AliFlowEventSimple::FillHarmonicCache()
+{
+  //fill the columns of the harmonic cache for the current tracks, if needed
+  if (fHarmonicCacheFilled && fHarmonicCacheNTracks==fNumberOfTracks) return;
+
+  fHarmonicCacheNTracks = fNumberOfTracks;
+  if (fCachePhi.GetSize()<fNumberOfTracks)
+  {
+    fCachePhi.Set(fNumberOfTracks);
+    fCachePt.Set(fNumberOfTracks);
+    fCacheEta.Set(fNumberOfTracks);
+    fCacheWeight.Set(fNumberOfTracks);
+    fCacheFlags.Set(fNumberOfTracks);
+  }
+  for(Int_t i=0; i<fNumberOfTracks; i++)
+  {
+    AliFlowTrackSimple* pTrack = (AliFlowTrackSimple*)fTrackCollection->At(i);
+    if(!pTrack)
+    {
+      cerr << "no particle!!!"<<endl;
+      fCachePhi[i] = 0.;
+      fCachePt[i] = 0.;
+      fCacheEta[i] = 0.;
+      fCacheWeight[i] = 0.;
+      fCacheFlags[i] = 0;
+      continue;
+    }
+    fCachePhi[i]    = pTrack->Phi();
+    fCachePt[i]     = pTrack->Pt();
+    fCacheEta[i]    = pTrack->Eta();
+    fCacheWeight[i] = pTrack->Weight();
+    Int_t flags = 0;
+    if(pTrack->InRPSelection()) flags |= kCacheRP;
+    if(pTrack->InPOISelection()) flags |= kCachePOI;
+    if(pTrack->InSubevent(0)) flags |= kCacheSubevent0;
+    if(pTrack->InSubevent(1)) flags |= kCacheSubevent1;
+    fCacheFlags[i] = flags;
+  }
+  for(Int_t n=0; n<=kMaxCachedHarmonic; n++)
+  {
+    fCacheHasHarmonic[n] = kFALSE;
+    for(Int_t s=0; s<3; s++) fCacheHasQ[n][s] = kFALSE;
+  }
+  fHarmonicCacheFilled = kTRUE;
+}
+
+//-----------------------------------------------------------------------
+void AliFlowEventSimple::FillHarmonicCacheHarmonic(Int_t n)
+{
+  //fill cos(n*phi) and sin(n*phi) of the tracks in the harmonic cache
+  FillHarmonicCache();
+  if (fCacheHasHarmonic[n]) return;
+  if (fCacheCos[n].GetSize()<fHarmonicCacheNTracks)
+  {
+    fCacheCos[n].Set(fHarmonicCacheNTracks);
+    fCacheSin[n].Set(fHarmonicCacheNTracks);
+  }
+  for(Int_t i=0; i<fHarmonicCacheNTracks; i++)
+  {
+    fCacheCos[n][i] = TMath::Cos(n*fCachePhi[i]);
+    fCacheSin[n][i] = TMath::Sin(n*fCachePhi[i]);
+  }
+  fCacheHasHarmonic[n] = kTRUE;
+}
+
+//-----------------------------------------------------------------------
+const Double_t* AliFlowEventSimple::GetCacheCos(Int_t n)
+{
+  //cos(n*phi) of the tracks from the harmonic cache (NULL if n is not in 0..kMaxCachedHarmonic)
+  if (n<0 || n>kMaxCachedHarmonic) return NULL;
+  FillHarmonicCacheHarmonic(n);
+  return fCacheCos[n].GetArray();
+}
+
+//-----------------------------------------------------------------------
+const Double_t* AliFlowEventSimple::GetCacheSin(Int_t n)
+{
+  //sin(n*phi) of the tracks from the harmonic cache (NULL if n is not in 0..kMaxCachedHarmonic)
+  if (n<0 || n>kMaxCachedHarmonic) return NULL;
+  FillHarmonicCacheHarmonic(n);
+  return fCacheSin[n].GetArray();
+}
+
+//-----------------------------------------------------------------------
+AliFlowVector AliFlowEventSimple::GetCacheQ(Int_t n, Int_t subevent)
+{
+  //Q-vector in harmonic n of the RPs (subevent=-1) or of the RPs of subevent 0/1, with the track
+  //weights only, from the harmonic cache. Same result as GetQ/Get2Qsub without phi/pt/eta weights
+  AliFlowVector vQ;
+  vQ.Set(0.,0.);
+  if (subevent<-1 || subevent>1) return vQ;
+
+  FillHarmonicCache();
+  const Int_t iSub = subevent+1;
+  const Int_t mask = kCacheRP | ((subevent==0)?kCacheSubevent0:0) | ((subevent==1)?kCacheSubevent1:0);
+  const Bool_t cached = (n>=0 && n<=kMaxCachedHarmonic);
+
+  Double_t dQX = 0.;
+  Double_t dQY = 0.;
+  Double_t sumOfWeights = 0.;
+  if (cached && fCacheHasQ[n][iSub])
+  {
+    dQX = fCacheQ[n][iSub][0];
+    dQY = fCacheQ[n][iSub][1];
+    sumOfWeights = fCacheQ[n][iSub][2];
+  }
+  else
+  {
+    const Double_t* cosn = GetCacheCos(n);
+    const Double_t* sinn = GetCacheSin(n);
+    for(Int_t i=0; i<fHarmonicCacheNTracks; i++)
+    {
+      if ((fCacheFlags[i] & mask) != mask) continue;
+      Double_t dWeight = fCacheWeight[i];
+      dQX += dWeight*(cosn ? cosn[i] : TMath::Cos(n*fCachePhi[i]));
+      dQY += dWeight*(sinn ? sinn[i] : TMath::Sin(n*fCachePhi[i]));
+      sumOfWeights += dWeight;
+    }
+    if (cached)
+    {
+      fCacheQ[n][iSub][0] = dQX;
+      fCacheQ[n][iSub][1] = dQY;
+      fCacheQ[n][iSub][2] = sumOfWeights;
+      fCacheHasQ[n][iSub] = kTRUE;
+    }
+  }
+
+  vQ.Set(dQX,dQY);
+  vQ.SetMult(sumOfWeights);
+  vQ.SetHarmonic(n);
+  vQ.SetPOItype(AliFlowTrackSimple::kRP);
+  vQ.SetSubeventNumber(subevent);
+  return vQ;
+}
+
 //------------------------------------------------------------------------------
 
 void AliFlowEventSimple::GetZDC2Qsub(AliFlowVector* Qarray)
@@ -893,6 +1077,14 @@ AliFlowEventSimple::AliFlowEventSimple( TTree* inputTree,
   fZPCM(0.),
   fZPAM(0.),
   fAbsOrbit(0),
+  fUseHarmonicCache(kFALSE),
+  fHarmonicCacheFilled(kFALSE),
+  fHarmonicCacheNTracks(0),
+  fCachePhi(),
+  fCachePt(),
+  fCacheEta(),
+  fCacheWeight(),
+  fCacheFlags(),
   fNumberOfPOItypes(2),
   fNumberOfPOIs(new Int_t[fNumberOfPOItypes])
 {
@@ -955,6 +1147,7 @@ AliFlowEventSimple::AliFlowEventSimple( TTree* inputTree,
 void AliFlowEventSimple::CloneTracks(Int_t n)
 {
   //clone every track n times to add non-flow
+  InvalidateHarmonicCache();
   if (n<=0) return; //no use to clone stuff zero or less times
   Int_t ntracks = fNumberOfTracks;
   fTrackCollection->Expand((n+1)*fNumberOfTracks);
@@ -974,6 +1167,7 @@ void AliFlowEventSimple::CloneTracks(Int_t n)
 void AliFlowEventSimple::ResolutionPt(Double_t res)
 {
   //smear pt of all tracks by gaussian with sigma=res
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -989,6 +1183,7 @@ void AliFlowEventSimple::TagSubeventsInEta( Double_t etaMinA,
                                             Double_t etaMaxB )
 {
   //Flag two subevents in given eta ranges
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1004,6 +1199,7 @@ void AliFlowEventSimple::TagSubeventsInEta( Double_t etaMinA,
 void AliFlowEventSimple::TagSubeventsByCharge()
 {
   //Flag two subevents in given eta ranges
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1019,6 +1215,7 @@ void AliFlowEventSimple::TagSubeventsByCharge()
 void AliFlowEventSimple::AddV1( Double_t v1 )
 {
   //add v2 to all tracks wrt the reaction plane angle
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1036,6 +1233,7 @@ void AliFlowEventSimple::AddV1( Double_t v1 )
 void AliFlowEventSimple::AddV2( Double_t v2 )
 {
   //add v2 to all tracks wrt the reaction plane angle
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1053,6 +1251,7 @@ void AliFlowEventSimple::AddV2( Double_t v2 )
 void AliFlowEventSimple::AddV3( Double_t v3 )
 {
   //add v3 to all tracks wrt the reaction plane angle
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1070,6 +1269,7 @@ void AliFlowEventSimple::AddV3( Double_t v3 )
 void AliFlowEventSimple::AddV4( Double_t v4 )
 {
   //add v4 to all tracks wrt the reaction plane angle
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1087,6 +1287,7 @@ void AliFlowEventSimple::AddV4( Double_t v4 )
 void AliFlowEventSimple::AddV5( Double_t v5 )
 {
   //add v4 to all tracks wrt the reaction plane angle
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1105,6 +1306,7 @@ void AliFlowEventSimple::AddFlow( Double_t v1, Double_t v2, Double_t v3, Double_
                                   Double_t rp1, Double_t rp2, Double_t rp3, Double_t rp4, Double_t rp5 )
 {
   //add flow to all tracks wrt the reaction plane angle, for all harmonic separate angle
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1117,6 +1319,7 @@ void AliFlowEventSimple::AddFlow( Double_t v1, Double_t v2, Double_t v3, Double_
 void AliFlowEventSimple::AddFlow( Double_t v1, Double_t v2, Double_t v3, Double_t v4, Double_t v5 )
 {
   //add flow to all tracks wrt the reaction plane angle
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1129,6 +1332,7 @@ void AliFlowEventSimple::AddFlow( Double_t v1, Double_t v2, Double_t v3, Double_
 void AliFlowEventSimple::AddV2( TF1* ptDepV2 )
 {
   //add v2 to all tracks wrt the reaction plane angle
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1143,6 +1347,7 @@ void AliFlowEventSimple::AddV2( TF1* ptDepV2 )
 void AliFlowEventSimple::AddV2( TF2* ptEtaDepV2 )
 {
   //add v2 to all tracks wrt the reaction plane angle
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1157,6 +1362,7 @@ void AliFlowEventSimple::AddV2( TF2* ptEtaDepV2 )
 void AliFlowEventSimple::TagRP( const AliFlowTrackSimpleCuts* cuts )
 {
   //tag tracks as reference particles (RPs)
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1179,6 +1385,7 @@ void AliFlowEventSimple::TagRP( const AliFlowTrackSimpleCuts* cuts )
 void AliFlowEventSimple::TagPOI( const AliFlowTrackSimpleCuts* cuts, Int_t poiType )
 {
   //tag tracks as particles of interest (POIs)
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1212,6 +1419,7 @@ void AliFlowEventSimple::DefineDeadZone( Double_t etaMin,
 {
   //mark tracks in given eta-phi region as dead
   //by resetting the flow bits
+  InvalidateHarmonicCache();
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
     AliFlowTrackSimple* track = static_cast<AliFlowTrackSimple*>(fTrackCollection->At(i));
@@ -1234,6 +1442,7 @@ Int_t AliFlowEventSimple::CleanUpDeadTracks()
 {
   //remove tracks that have no flow tags set and cleanup the container
   //returns number of cleaned tracks
+  InvalidateHarmonicCache();
   Int_t ncleaned=0;
   for (Int_t i=0; i<fNumberOfTracks; i++)
   {
@@ -1272,6 +1481,7 @@ TF1* AliFlowEventSimple::SimplePtSpectrum()
 void AliFlowEventSimple::ClearFast()
 {
   //clear the counters without deleting allocated objects so they can be reused
+  InvalidateHarmonicCache();
   fReferenceMultiplicity = 0;
   fNumberOfTracks = 0;
   for (Int_t i=0; i<fNumberOfPOItypes; i++)
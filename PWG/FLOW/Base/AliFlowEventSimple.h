@@ -19,6 +19,8 @@
 #include "TObject.h"
 #include "TParameter.h"
 #include "TMath.h"
+#include "TArrayD.h"
+#include "TArrayI.h"
 #include "AliFlowVector.h"
 class TTree;
 class TF1;
@@ -31,6 +33,8 @@ class AliFlowEventSimple: public TObject {
  public:
 
   enum ConstructionMethod {kEmpty,kGenerate};
+  enum HarmonicCacheFlag {kCacheRP=BIT(0),kCachePOI=BIT(1),kCacheSubevent0=BIT(2),kCacheSubevent1=BIT(3)};
+  enum {kMaxCachedHarmonic=16};
 
   AliFlowEventSimple();
   AliFlowEventSimple( Int_t nParticles,
@@ -128,6 +132,23 @@ class AliFlowEventSimple: public TObject {
   virtual void SetVertexPosition(Double_t* pos);
   virtual void GetVertexPosition(Double_t* pos);
 
+  // per-event harmonic cache: columns of the track kinematics and flags, cos(n*phi)/sin(n*phi) and
+  // Q-vectors (track weights only) filled on demand, to be shared by the flow methods analysing the same event.
+  // if enabled GetQ/Get2Qsub use it when no phi/pt/eta weights are requested. Tracks modified through
+  // GetTrack() require a call to InvalidateHarmonicCache()
+  void     SetUseHarmonicCache(Bool_t b=kTRUE)      { fUseHarmonicCache=b; InvalidateHarmonicCache(); }
+  Bool_t   GetUseHarmonicCache() const              { return fUseHarmonicCache; }
+  void     InvalidateHarmonicCache()                { fHarmonicCacheFilled=kFALSE; }
+  Int_t           GetCacheNumberOfTracks()          { FillHarmonicCache(); return fHarmonicCacheNTracks; }
+  const Double_t* GetCachePhi()                     { FillHarmonicCache(); return fCachePhi.GetArray(); }
+  const Double_t* GetCachePt()                      { FillHarmonicCache(); return fCachePt.GetArray(); }
+  const Double_t* GetCacheEta()                     { FillHarmonicCache(); return fCacheEta.GetArray(); }
+  const Double_t* GetCacheWeight()                  { FillHarmonicCache(); return fCacheWeight.GetArray(); }
+  const Int_t*    GetCacheFlags()                   { FillHarmonicCache(); return fCacheFlags.GetArray(); }
+  const Double_t* GetCacheCos(Int_t n);
+  const Double_t* GetCacheSin(Int_t n);
+  AliFlowVector   GetCacheQ(Int_t n=2, Int_t subevent=-1);
+
   void SetCentrality(Double_t c) {fCentrality=c;};
   Double_t GetCentrality() const {return fCentrality;};
   void SetCentralityCL1(Double_t c) {fCentralityCL1=c;};
@@ -154,6 +175,9 @@ class AliFlowEventSimple: public TObject {
   UInt_t GetAbsOrbit() const {return fAbsOrbit;};
 
  protected:
+  void FillHarmonicCache();
+  void FillHarmonicCacheHarmonic(Int_t n);
+
   virtual void Generate( Int_t nParticles,
                          TF1* ptDist=NULL,
                          Double_t phiMin=0.0,
@@ -204,12 +228,26 @@ class AliFlowEventSimple: public TObject {
   Double_t                fZPAM;                      // total energy from ZPC-A
   Double_t                fVtxPos[3];                 // Primary vertex position (x,y,z)
   UInt_t                  fAbsOrbit;                  // Absolute orbit number
+  // per-event harmonic cache
+  Bool_t                  fUseHarmonicCache;          //! use the harmonic cache in GetQ/Get2Qsub
+  Bool_t                  fHarmonicCacheFilled;       //! columns are filled for the current tracks
+  Int_t                   fHarmonicCacheNTracks;      //! number of tracks in the columns
+  TArrayD                 fCachePhi;                  //! phi of the tracks
+  TArrayD                 fCachePt;                   //! pt of the tracks
+  TArrayD                 fCacheEta;                  //! eta of the tracks
+  TArrayD                 fCacheWeight;               //! weight of the tracks
+  TArrayI                 fCacheFlags;                //! RP/POI/subevent flags of the tracks (HarmonicCacheFlag)
+  TArrayD                 fCacheCos[kMaxCachedHarmonic+1]; //! cos(n*phi) of the tracks
+  TArrayD                 fCacheSin[kMaxCachedHarmonic+1]; //! sin(n*phi) of the tracks
+  Bool_t                  fCacheHasHarmonic[kMaxCachedHarmonic+1]; //! cos/sin filled for harmonic n
+  Bool_t                  fCacheHasQ[kMaxCachedHarmonic+1][3];     //! Q-vector filled for harmonic n and all RPs/subevent 0/subevent 1
+  Double_t                fCacheQ[kMaxCachedHarmonic+1][3][3];     //! Qx, Qy and sum of weights
 
  private:
   Int_t                   fNumberOfPOItypes;    // how many different flow particle types do we have? (RP,POI,POI_2,...)
   Int_t*                  fNumberOfPOIs;          //[fNumberOfPOItypes] number of tracks that have passed the POI selection
 
-  ClassDef(AliFlowEventSimple,7)
+  ClassDef(AliFlowEventSimple,8)
 };
 
 #endif
@@ -138,6 +138,7 @@ AliAnalysisTaskFlowEvent::AliAnalysisTaskFlowEvent() :
   fDifferentialV2(0),
   fFlowEvent(NULL),
   fShuffleTracks(kFALSE),
+  fUseHarmonicCache(kFALSE),
   fMyTRandom3(NULL)
 {
   // Constructor
@@ -200,6 +201,7 @@ AliAnalysisTaskFlowEvent::AliAnalysisTaskFlowEvent(const char *name, TString RPt
   fDifferentialV2(0),
   fFlowEvent(NULL),
   fShuffleTracks(kFALSE),
+  fUseHarmonicCache(kFALSE),
   fMyTRandom3(NULL)
 {
   // Constructor
@@ -584,6 +586,9 @@ void AliAnalysisTaskFlowEvent::UserExec(Option_t *)
   // associate the mother particles to their daughters in the flow event (if any)
   fFlowEvent->FindDaughters();
 
+  // share the harmonic cache of the flow event between the flow methods (cache is reset here)
+  fFlowEvent->SetUseHarmonicCache(fUseHarmonicCache);
+
   //fListHistos->Print();
   //fOutputFile->WriteObject(fFlowEvent,"myFlowEventSimple");
   PostData(1,fFlowEvent);
@@ -87,6 +87,8 @@ class AliAnalysisTaskQCumulants : public AliAnalysisTaskSE{
   Bool_t GetFillProfilesVsMUsingWeights() const {return this->fFillProfilesVsMUsingWeights;};
   void SetUseQvectorTerms(Bool_t const uqvt){this->fUseQvectorTerms = uqvt;if(uqvt){this->fStoreControlHistograms = kTRUE;}};
   Bool_t GetUseQvectorTerms() const {return this->fUseQvectorTerms;};
+  void SetUseQvectorRecurrence(Bool_t const uqvr){this->fUseQvectorRecurrence = uqvr;};
+  Bool_t GetUseQvectorRecurrence() const {return this->fUseQvectorRecurrence;};
  
   // Multiparticle correlations vs multiplicity:
   void SetnBinsMult(Int_t const nbm) {this->fnBinsMult = nbm;};
@@ -165,6 +167,7 @@ class AliAnalysisTaskQCumulants : public AliAnalysisTaskSE{
   Bool_t fUse2DHistograms;               // use TH2D instead of TProfile to improve numerical stability in reference flow calculation   
   Bool_t fFillProfilesVsMUsingWeights;   // if the width of multiplicity bin is 1, weights are not needed   
   Bool_t fUseQvectorTerms; // use TH2D with separate Q-vector terms instead of TProfile to improve numerical stability in reference flow calculation    
+  Bool_t fUseQvectorRecurrence; // calculate e-b-e Q-vectors with multiple-angle recurrence and running products of weights
   // Multiparticle correlations vs multiplicity:
   Int_t fnBinsMult;                   // number of multiplicity bins for flow analysis versus multiplicity  
   Double_t fMinMult;                  // minimal multiplicity for flow analysis versus multiplicity  
@@ -192,7 +195,7 @@ class AliAnalysisTaskQCumulants : public AliAnalysisTaskSE{
   Bool_t fUseBootstrapVsM; // use bootstrap to estimate statistical spread for results vs M
   Int_t fnSubsamples; // number of subsamples (SS), by default 10
   
-  ClassDef(AliAnalysisTaskQCumulants, 2); 
+  ClassDef(AliAnalysisTaskQCumulants, 3); 
 };
 
 //================================================================================================================
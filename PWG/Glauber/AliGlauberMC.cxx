@@ -32,6 +32,7 @@
 #include <TFile.h>
 #include <TTree.h>
 #include <TF1.h>
+#include <algorithm>
 
 #include "AliGlauberNucleon.h"
 #include "AliGlauberNucleus.h"
@@ -172,7 +173,20 @@ AliGlauberMC::AliGlauberMC(Option_t* NA, Option_t* NB, Double_t xsect) :
   fOmega(0),
   fSig0(0),
   fLambda(0),
-  fSigFluc(0)
+  fSigFluc(0),
+  fFastColl(kFALSE),
+  fSigFlucNpx(0),
+  fSigFlucTable(),
+  fSigFlucTableTried(kFALSE),
+  fXA(),
+  fYA(),
+  fSigA(),
+  fXB(),
+  fYB(),
+  fSigB(),
+  fCellStart(),
+  fCellIndex(),
+  fCandidates()
 {
   //ctor
   for (UInt_t i=0; i<(sizeof(fdNdEtaParam)/sizeof(fdNdEtaParam[0])); i++)
@@ -322,7 +336,20 @@ AliGlauberMC::AliGlauberMC(const AliGlauberMC& in):
   fOmega(in.fOmega),
   fSig0(in.fSig0),
   fLambda(in.fLambda),
-  fSigFluc(in.fSigFluc)
+  fSigFluc(in.fSigFluc),
+  fFastColl(in.fFastColl),
+  fSigFlucNpx(in.fSigFlucNpx),
+  fSigFlucTable(in.fSigFlucTable),
+  fSigFlucTableTried(in.fSigFlucTableTried),
+  fXA(),
+  fYA(),
+  fSigA(),
+  fXB(),
+  fYB(),
+  fSigB(),
+  fCellStart(),
+  fCellIndex(),
+  fCandidates()
 {
   //copy ctor
   memcpy(fdNdEtaParam,in.fdNdEtaParam,sizeof(fdNdEtaParam));
@@ -453,6 +480,10 @@ AliGlauberMC& AliGlauberMC::operator=(const AliGlauberMC& in)
   fSxyCom=in.fSxyCom;
   fX=in.fX;
   fNpp=in.fNpp;
+  fFastColl=in.fFastColl;
+  fSigFlucNpx=in.fSigFlucNpx;
+  fSigFlucTable=in.fSigFlucTable;
+  fSigFlucTableTried=in.fSigFlucTableTried;
   return *this;
 }
 
@@ -467,6 +498,8 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
       fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
       cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
     }
+    if (fSigFlucNpx>0 && !fSigFlucTableTried)
+      BuildSigFlucTable();
   }
 
   fANucleus.ThrowNucleons(-bgen/2.);
@@ -480,7 +513,7 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     nucleonA->SetInNucleusA();
     nucleonA->SetSigNN(fXSect);
     if (fDoFluc)
-      nucleonA->SetSigNN(fSigFluc->GetRandom());
+      nucleonA->SetSigNN(GetRandomSigNN());
   }
   fBNucleus.ThrowNucleons(bgen/2.);
   fNucleonsB = fBNucleus.GetNucleons();
@@ -493,7 +526,7 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
     nucleonB->SetInNucleusB();
     nucleonB->SetSigNN(fXSect);
     if (fDoFluc)
-      nucleonB->SetSigNN(fSigFluc->GetRandom());
+      nucleonB->SetSigNN(GetRandomSigNN());
   }
 
   if (fDoFluc) {
@@ -502,7 +535,7 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
       fSigFluc->SetParameters(1,fSig0,fOmega,fLambda);
       cout << "Setting fluc: " << fSig0 << " " << fOmega << " " << fLambda << endl;
     }
-    fXSect = fSigFluc->GetRandom();
+    fXSect = GetRandomSigNN();
   }
   // "ball" diameter = distance at which two balls interact
   Double_t d2 = (Double_t)fXSect/(TMath::Pi()*10); // in fm^2
@@ -511,6 +544,14 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
   Double_t Nco   = 0;
   Double_t Ncohc = 0; // hard core
 
+  if (fFastColl) {
+    // grid based search, same collisions and sums as the pair loop below
+    CalcCollisionsFast(d2, bNN, Nco, Ncohc);
+    fNcollw = Ncohc;
+    fBNN = (Nco>0) ? bNN/Nco : 0.;
+    return CalcResults(bgen);
+  }
+
   // for each of the A nucleons in nucleus B
   for (Int_t i = 0; i<fBN; i++)
   {
@@ -554,6 +595,181 @@ Bool_t AliGlauberMC::CalcEvent(Double_t bgen)
   return CalcResults(bgen);
 }
 
+//______________________________________________________________________________
+void AliGlauberMC::CalcCollisionsFast(Double_t d2, Double_t &bNN, Double_t &Nco, Double_t &Ncohc)
+{
+  // Find the binary collisions as in CalcEvent, with the positions in
+  // contiguous arrays and the nucleons of A sorted in a 2-D grid of cells
+  // at least as large as the largest interaction distance: for each
+  // nucleon in B only the nucleons of A in the 3x3 neighbouring cells are
+  // tested. The candidates are tested in the original order, so the
+  // collisions and the sums are identical to the full pair loop.
+
+  const Int_t kMaxCells = 64; // per dimension
+
+  if (fAN<1 || fBN<1) return;
+
+  fXA.Set(fAN);
+  fYA.Set(fAN);
+  fSigA.Set(fAN);
+  fXB.Set(fBN);
+  fYB.Set(fBN);
+  fSigB.Set(fBN);
+  Double_t sigMax = 0.;
+  Double_t xmin = 0., xmax = 0., ymin = 0., ymax = 0.;
+  for (Int_t j = 0; j<fAN; j++)
+  {
+    AliGlauberNucleon *nucleonA=(AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j));
+    fXA[j]   = nucleonA->GetX();
+    fYA[j]   = nucleonA->GetY();
+    fSigA[j] = nucleonA->GetSigNN();
+    if (fSigA[j]>sigMax) sigMax = fSigA[j];
+    if (j==0 || fXA[j]<xmin) xmin = fXA[j];
+    if (j==0 || fXA[j]>xmax) xmax = fXA[j];
+    if (j==0 || fYA[j]<ymin) ymin = fYA[j];
+    if (j==0 || fYA[j]>ymax) ymax = fYA[j];
+  }
+  for (Int_t i = 0; i<fBN; i++)
+  {
+    AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
+    fXB[i]   = nucleonB->GetX();
+    fYB[i]   = nucleonB->GetY();
+    fSigB[i] = nucleonB->GetSigNN();
+    if (fSigB[i]>sigMax) sigMax = fSigB[i];
+  }
+
+  // cross section of the last pair, as left by the full pair loop
+  if (fDoFluc)
+    fXSect = TMath::Max(fSigA[fAN-1],fSigB[fBN-1]);
+
+  // largest interaction distance (squared)
+  Double_t d2Max = fDoFluc ? (Double_t)sigMax/(TMath::Pi()*10) : d2;
+  if (!(d2Max>0)) return;
+
+  // cells, with a margin against rounding
+  Double_t cellX = TMath::Sqrt(d2Max)*(1+1e-6);
+  Double_t cellY = cellX;
+  Double_t rx = (xmax-xmin)/cellX;
+  Double_t ry = (ymax-ymin)/cellY;
+  Int_t nx = kMaxCells;
+  Int_t ny = kMaxCells;
+  if (rx < kMaxCells-0.5) nx = Int_t(rx)+1;
+  else cellX = (xmax-xmin)/(kMaxCells-0.5);
+  if (ry < kMaxCells-0.5) ny = Int_t(ry)+1;
+  else cellY = (ymax-ymin)/(kMaxCells-0.5);
+
+  // sort the nucleons of A by cell, in increasing order within a cell
+  Int_t ncells = nx*ny;
+  fCellStart.Set(ncells+1);
+  fCellStart.Reset();
+  fCellIndex.Set(fAN);
+  for (Int_t j = 0; j<fAN; j++)
+    fCellStart[Int_t((fXA[j]-xmin)/cellX)*ny+Int_t((fYA[j]-ymin)/cellY)+1]++;
+  for (Int_t c = 0; c<ncells; c++)
+    fCellStart[c+1] += fCellStart[c];
+  for (Int_t j = 0; j<fAN; j++)
+    fCellIndex[fCellStart[Int_t((fXA[j]-xmin)/cellX)*ny+Int_t((fYA[j]-ymin)/cellY)]++] = j;
+  for (Int_t c = ncells; c>0; c--)
+    fCellStart[c] = fCellStart[c-1];
+  fCellStart[0] = 0;
+
+  // for each of the A nucleons in nucleus B
+  fCandidates.Set(fAN);
+  Int_t *candidates = fCandidates.GetArray();
+  for (Int_t i = 0; i<fBN; i++)
+  {
+    Double_t fx = (fXB[i]-xmin)/cellX;
+    Double_t fy = (fYB[i]-ymin)/cellY;
+    if (fx < -2 || fx > nx+1 || fy < -2 || fy > ny+1) continue;
+    Int_t ix = Int_t(TMath::Floor(fx));
+    Int_t iy = Int_t(TMath::Floor(fy));
+    Int_t nc = 0;
+    for (Int_t cx = TMath::Max(ix-1,0); cx <= TMath::Min(ix+1,nx-1); cx++)
+    {
+      for (Int_t cy = TMath::Max(iy-1,0); cy <= TMath::Min(iy+1,ny-1); cy++)
+      {
+        Int_t c = cx*ny+cy;
+        for (Int_t k = fCellStart[c]; k<fCellStart[c+1]; k++)
+          candidates[nc++] = fCellIndex[k];
+      }
+    }
+    if (nc==0) continue;
+    std::sort(candidates, candidates+nc);
+
+    AliGlauberNucleon *nucleonB=(AliGlauberNucleon*)(fNucleonsB->UncheckedAt(i));
+    for (Int_t k = 0; k<nc; k++)
+    {
+      Int_t j = candidates[k];
+      Double_t dx = fXB[i]-fXA[j];
+      Double_t dy = fYB[i]-fYA[j];
+      Double_t dij = dx*dx+dy*dy;
+      if (fDoFluc)
+        d2 = (Double_t)TMath::Max(fSigA[j],fSigB[i])/(TMath::Pi()*10); // in fm^2
+      if (dij < d2)
+      {
+        bNN += dij;
+        ++Nco;
+        nucleonB->Collide();
+        ((AliGlauberNucleon*)(fNucleonsA->UncheckedAt(j)))->Collide();
+        if (dij<d2/4)
+          ++Ncohc;
+      }
+    }
+  }
+}
+
+//______________________________________________________________________________
+void AliGlauberMC::BuildSigFlucTable()
+{
+  // Tabulate the inverse of the cumulative distribution of fSigFluc at
+  // fSigFlucNpx+1 equidistant probabilities, sampled with a linear
+  // interpolation by GetRandomSigNN
+
+  fSigFlucTable.Set(0);
+  if (!fSigFluc || fSigFlucNpx<1) return;
+  fSigFlucTableTried = kTRUE; // a failure is reported once, then TF1::GetRandom is used
+
+  const Int_t nstep = 10*fSigFlucNpx; // integration steps
+  Double_t xmin = 0., xmax = 0.;
+  fSigFluc->GetRange(xmin,xmax);
+  Double_t dx = (xmax-xmin)/nstep;
+  TArrayD cdf(nstep+1);
+  Double_t fprev = TMath::Max(fSigFluc->Eval(xmin),0.);
+  for (Int_t k = 1; k<=nstep; k++)
+  {
+    Double_t f = TMath::Max(fSigFluc->Eval(xmin+k*dx),0.);
+    cdf[k] = cdf[k-1]+0.5*(fprev+f)*dx;
+    fprev = f;
+  }
+  if (!(cdf[nstep]>0))
+  {
+    cout << "AliGlauberMC: cannot tabulate sigNN fluctuations, using TF1::GetRandom" << endl;
+    return;
+  }
+
+  fSigFlucTable.Set(fSigFlucNpx+1);
+  Int_t k = 0;
+  for (Int_t i = 0; i<=fSigFlucNpx; i++)
+  {
+    Double_t u = cdf[nstep]*i/fSigFlucNpx;
+    while (k<nstep-1 && cdf[k+1]<u) k++;
+    Double_t w = cdf[k+1]-cdf[k];
+    fSigFlucTable[i] = xmin+dx*(k+(w>0 ? (u-cdf[k])/w : 0.));
+  }
+}
+
+//______________________________________________________________________________
+Double_t AliGlauberMC::GetRandomSigNN()
+{
+  // sample the fluctuating sigNN, from the inverse-CDF table if requested
+
+  Int_t n = fSigFlucTable.GetSize()-1;
+  if (fSigFlucNpx<1 || n<1) return fSigFluc->GetRandom();
+  Double_t u = gRandom->Rndm()*n;
+  Int_t i = TMath::Min(Int_t(u),n-1);
+  return fSigFlucTable[i]+(u-i)*(fSigFlucTable[i+1]-fSigFlucTable[i]);
+}
+
 //______________________________________________________________________________
 Bool_t AliGlauberMC::CalcResults(Double_t bgen)
 {
@@ -16,6 +16,8 @@
 #include "AliGlauberNucleus.h"
 #include <Riostream.h>
 #include <TNamed.h>
+#include <TArrayD.h>
+#include <TArrayI.h>
 
 class TObjArray;
 class TNtuple;
@@ -100,6 +102,8 @@ public:
    void   Seta(Double_t a)  {fANucleus.SetA(a); fBNucleus.SetA(a);}
    void   SetDoFluc(Double_t omega, Double_t sig0, Double_t lam, Bool_t on=kTRUE) 
             {fDoFluc=on;fOmega=omega;fSig0=sig0;fLambda=lam;}
+   void   SetFastCollisions(Bool_t b=kTRUE) { fFastColl = b; }
+   void   SetSigFlucTableSize(Int_t n)      { fSigFlucNpx = n; fSigFlucTableTried = kFALSE; }
    static void       PrintVersion()         {cout << "AliGlauberMC " << Version() << endl;}
    static const char *Version()             {return "v1.2";}
    static void       RunAndSaveNtuple( Int_t n,
@@ -251,9 +255,25 @@ private:
    Double_t     fSig0;           //regularization parameter 
    Double_t     fLambda;         //lambda parameter
    TF1         *fSigFluc;        //!parameterization for fluctuating sigNN
+   Bool_t       fFastColl;       //=kTRUE then collisions are found with a cell grid (same result)
+   Int_t        fSigFlucNpx;     //>0 then fluctuating sigNN sampled from an inverse-CDF table of this size
+   TArrayD      fSigFlucTable;   //!sigNN at equidistant values of the cumulative distribution
+   Bool_t       fSigFlucTableTried; //!=kTRUE once the table was built (or failed to build) for fSigFlucNpx
+   TArrayD      fXA;             //!x of nucleons in nucleus A (fast collision finding)
+   TArrayD      fYA;             //!y of nucleons in nucleus A
+   TArrayD      fSigA;           //!sigNN of nucleons in nucleus A
+   TArrayD      fXB;             //!x of nucleons in nucleus B
+   TArrayD      fYB;             //!y of nucleons in nucleus B
+   TArrayD      fSigB;           //!sigNN of nucleons in nucleus B
+   TArrayI      fCellStart;      //!first entry of each grid cell in fCellIndex
+   TArrayI      fCellIndex;      //!indices of nucleons in A, ordered by cell
+   TArrayI      fCandidates;     //!candidate nucleons in A for one nucleon in B
    Bool_t       CalcResults(Double_t bgen);
+   void         CalcCollisionsFast(Double_t d2, Double_t &bNN, Double_t &Nco, Double_t &Ncohc);
+   void         BuildSigFlucTable();
+   Double_t     GetRandomSigNN();
 
-   ClassDef(AliGlauberMC,4)
+   ClassDef(AliGlauberMC,5)
 };
 
 #endif
@@ -53,7 +53,10 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT() :
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fAxisMinCache(0),
+  fAxisMaxCache(0),
+  fAxisEdgesCache(0)
 {
   // Constructor
 }
@@ -69,7 +72,10 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const Char_t* name, const Char_t*
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fAxisMinCache(0),
+  fAxisMaxCache(0),
+  fAxisEdgesCache(0)
 {
   // Constructor
 
@@ -106,7 +112,10 @@ AliTHnT<TemplateArray, TemplateType>::AliTHnT(const AliTHnT &c) :
   axisCache(0),
   fNbinsCache(0),
   fLastVars(0),
-  fLastBins(0)
+  fLastBins(0),
+  fAxisMinCache(0),
+  fAxisMaxCache(0),
+  fAxisEdgesCache(0)
 {
   //
   // AliTHnT copy constructor
@@ -135,6 +144,9 @@ AliTHnT<TemplateArray, TemplateType>::~AliTHnT()
   delete[] fNbinsCache;
   delete[] fLastVars;
   delete[] fLastBins;
+  delete[] fAxisMinCache;
+  delete[] fAxisMaxCache;
+  delete[] fAxisEdgesCache;
 }
 
 template <class TemplateArray, typename TemplateType>
@@ -281,21 +293,42 @@ Long64_t AliTHnT<TemplateArray, TemplateType>::Merge(TCollection* list)
   return count+1;
 }
 
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::InitAxisCache()
+{
+  // fills the axis cache used by Fill and FillN
+  
+  delete[] axisCache;
+  delete[] fNbinsCache;
+  delete[] fAxisMinCache;
+  delete[] fAxisMaxCache;
+  delete[] fAxisEdgesCache;
+  
+  axisCache = new TAxis*[fNVars];
+  fNbinsCache = new Int_t[fNVars];
+  fAxisMinCache = new Double_t[fNVars];
+  fAxisMaxCache = new Double_t[fNVars];
+  fAxisEdgesCache = new const Double_t*[fNVars];
+  for (Int_t i=0; i<fNVars; i++)
+  {
+    axisCache[i] = GetAxis(i, 0);
+    fNbinsCache[i] = axisCache[i]->GetNbins();
+    fAxisMinCache[i] = axisCache[i]->GetXmin();
+    fAxisMaxCache[i] = axisCache[i]->GetXmax();
+    fAxisEdgesCache[i] = (axisCache[i]->GetXbins()->GetSize() > 0) ? axisCache[i]->GetXbins()->GetArray() : 0;
+  }
+}
+
 template <class TemplateArray, typename TemplateType>
 void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep, Double_t weight)
 {
   // fills an entry
 
   // fill axis cache
-  if (!axisCache)
+  if (!fLastVars)
   {
-    axisCache = new TAxis*[fNVars];
-    fNbinsCache = new Int_t[fNVars];
-    for (Int_t i=0; i<fNVars; i++)
-    {
-      axisCache[i] = GetAxis(i, 0);
-      fNbinsCache[i] = axisCache[i]->GetNbins();
-    }
+    if (!fAxisMinCache)
+      InitAxisCache();
     
     fLastVars = new Double_t[fNVars];
     fLastBins = new Int_t[fNVars];
@@ -334,6 +367,56 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
 //     Printf("%lld", bin);
   }
 
+  AddToBin(bin, istep, weight);
+  
+  // debug
+//   AliCFContainer::Fill(var, istep, weight);
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::FillN(Int_t n, const Double_t *vars, const Int_t *steps, const Double_t *weights)
+{
+  // fills n entries
+  //   vars contains the values of entry i at vars[i*fNVars] ... vars[i*fNVars+fNVars-1]
+  //   steps contains the step of each entry
+  //   weights contains the weight of each entry; if 0, all weights are 1
+  // the result is the same as calling Fill for each entry, but bins of axes with fixed bin width are 
+  // calculated directly from the cached axis limits (TAxis::FindBin is not called)
+
+  if (!fAxisMinCache)
+    InitAxisCache();
+  
+  for (Int_t i=0; i<n; i++)
+  {
+    const Double_t* var = vars + (Long64_t) i * fNVars;
+    
+    // calculate global bin index
+    Long64_t bin = 0;
+    Int_t j = 0;
+    for (; j<fNVars; j++)
+    {
+      Int_t tmpBin = FindBinCached(j, var[j]);
+      
+      // under/overflow not supported
+      if (tmpBin < 1 || tmpBin > fNbinsCache[j])
+        break;
+      
+      // bins start from 0 here
+      bin = bin * fNbinsCache[j] + tmpBin - 1;
+    }
+    
+    if (j < fNVars)
+      continue;
+    
+    AddToBin(bin, steps[i], (weights) ? weights[i] : 1.);
+  }
+}
+
+template <class TemplateArray, typename TemplateType>
+void AliTHnT<TemplateArray, TemplateType>::AddToBin(Long64_t bin, Int_t istep, Double_t weight)
+{
+  // adds weight to the global bin <bin> of step <istep>, creating the containers if needed
+
   if (!fValues[istep])
   {
     fValues[istep] = new TemplateArray(fNBins);
@@ -355,9 +438,6 @@ void AliTHnT<TemplateArray, TemplateType>::Fill(const Double_t *var, Int_t istep
     fSumw2[istep]->GetArray()[bin] += weight * weight;
   
 //   Printf("%f", fValues[istep][bin]);
-  
-  // debug
-//   AliCFContainer::Fill(var, istep, weight);
 }
 
 template <class TemplateArray, typename TemplateType>
@@ -12,6 +12,7 @@
 
 #include "TObject.h"
 #include "TString.h"
+#include "TMath.h"
 #include "AliCFContainer.h"
 
 class TArray;
@@ -26,6 +27,7 @@ public:
   AliTHnBase(const Char_t* name, const Char_t* title,const Int_t nSelStep, const Int_t nVarIn, const Int_t* nBinIn) : AliCFContainer(name, title, nSelStep, nVarIn, nBinIn) { }
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) = 0;
+  virtual void FillN(Int_t n, const Double_t *vars, const Int_t *steps, const Double_t *weights=0);
   virtual void FillParent() = 0;
   virtual void FillContainer(AliCFContainer* cont) = 0;
 
@@ -48,6 +50,7 @@ class AliTHnT : public AliTHnBase
   virtual ~AliTHnT();
   
   virtual void Fill(const Double_t *var, Int_t istep, Double_t weight=1.) ;
+  virtual void FillN(Int_t n, const Double_t *vars, const Int_t *steps, const Double_t *weights=0);
   virtual void FillParent();
   virtual void FillContainer(AliCFContainer* cont);
   
@@ -65,6 +68,9 @@ class AliTHnT : public AliTHnBase
   
 protected:
   void Init();
+  void InitAxisCache();
+  Int_t FindBinCached(Int_t axis, Double_t x) const;
+  void AddToBin(Long64_t bin, Int_t istep, Double_t weight);
   Long64_t GetGlobalBinIndex(const Int_t* binIdx);
   
   Long64_t fNBins;   // number of total bins
@@ -77,10 +83,36 @@ protected:
   Int_t* fNbinsCache; //! cache Nbins per axis
   Double_t* fLastVars; //! caching of last used bins (in many loops some vars are the same for a while)
   Int_t* fLastBins; //! caching of last used bins (in many loops some vars are the same for a while)
+  Double_t* fAxisMinCache; //! cache lower edge per axis
+  Double_t* fAxisMaxCache; //! cache upper edge per axis
+  const Double_t** fAxisEdgesCache; //! cache bin edges per axis, 0 for axes with fixed bin width
   
   ClassDef(AliTHnT, 5) // THn like container
 };
 
+inline void AliTHnBase::FillN(Int_t n, const Double_t *vars, const Int_t *steps, const Double_t *weights)
+{
+  // fills n entries, see AliTHnT::FillN
+  
+  for (Int_t i=0; i<n; i++)
+    Fill(vars + (Long64_t) i * GetNVar(), steps[i], (weights) ? weights[i] : 1.);
+}
+
+template <class TemplateArray, typename TemplateType>
+inline Int_t AliTHnT<TemplateArray, TemplateType>::FindBinCached(Int_t axis, Double_t x) const
+{
+  // same result as TAxis::FindBin (for axes which cannot be extended), but uses the cached axis limits
+  // binary search is only needed for axes with variable bin width
+  
+  if (x < fAxisMinCache[axis])
+    return 0;
+  if (!(x < fAxisMaxCache[axis]))
+    return fNbinsCache[axis] + 1;
+  if (!fAxisEdgesCache[axis])
+    return 1 + Int_t(fNbinsCache[axis] * (x - fAxisMinCache[axis]) / (fAxisMaxCache[axis] - fAxisMinCache[axis]));
+  return 1 + TMath::BinarySearch(fNbinsCache[axis] + 1, fAxisEdgesCache[axis], x);
+}
+
 typedef AliTHnT<TArrayF, Float_t> AliTHn;
 typedef AliTHnT<TArrayD, Double_t> AliTHnD;
 
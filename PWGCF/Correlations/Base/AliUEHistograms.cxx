@@ -76,6 +76,7 @@ AliUEHistograms::AliUEHistograms(const char* name, const char* histograms, const
   fPtOrder(kTRUE),
   fTwoTrackCutMinRadius(0.8),
   fCheckEventNumberInCorrelation(kFALSE),
+  fUsePairKernel(kFALSE),
   fRunNumber(0),
   fMergeCount(1)
 {
@@ -247,6 +248,7 @@ AliUEHistograms::AliUEHistograms(const AliUEHistograms &c) :
   fPtOrder(kTRUE),
   fTwoTrackCutMinRadius(0.8),
   fCheckEventNumberInCorrelation(kFALSE),
+  fUsePairKernel(kFALSE),
   fRunNumber(0),
   fMergeCount(1)
 {
@@ -566,6 +568,16 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
     TH1::AddDirectory(oldStatus);
   }
 
+  if (particles && fUsePairKernel)
+  {
+    FillCorrelationsPairKernel(centrality, zVtx, step, particles, mixed, weight, firstTime, twoTrackEfficiencyCut, bSign, twoTrackEfficiencyCutValue, applyEfficiency);
+
+    fCentralityDistribution->Fill(centrality);
+    fCentralityCorrelation->Fill(centrality, particles->GetEntriesFast());
+    FillEvent(centrality, step);
+    return;
+  }
+
   // Eta() is extremely time consuming, therefore cache it for the inner loop here:
   TObjArray* input = (mixed) ? mixed : particles;
   TArrayF eta(input->GetEntriesFast());
@@ -581,33 +593,7 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
     
     TH1* triggerWeighting = 0;
     if (fWeightPerEvent)
-    {
-      TAxis* axis = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->GetGrid(0)->GetGrid()->GetAxis(2);
-      triggerWeighting = new TH1F("triggerWeighting", "", axis->GetNbins(), axis->GetXbins()->GetArray());
-    
-      for (Int_t i=0; i<particles->GetEntriesFast(); i++)
-      {
-	AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
-	
-	// some optimization
-	Float_t triggerEta = triggerParticle->Eta();
-
-	if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
-	  continue;
-
-	if (fOnlyOneEtaSide != 0)
-	{
-	  if (fOnlyOneEtaSide * triggerEta < 0)
-	    continue;
-	}
-	
-	if (fTriggerSelectCharge != 0)
-	  if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
-	    continue;
-	
-	triggerWeighting->Fill(triggerParticle->Pt());
-      }
-    }
+      triggerWeighting = CreateTriggerWeighting(particles);
     
     // identify K, Lambda candidates and flag those particles
     // a TObject bit is used for this
@@ -945,60 +931,615 @@ void AliUEHistograms::FillCorrelations(Double_t centrality, Float_t zVtx, AliUEH
       }
  
       if (firstTime)
+        FillTriggerParticle(centrality, zVtx, step, triggerEta, triggerParticle->Pt(), triggerParticle->Phi(), triggerWeighting, applyEfficiency);
+    }
+    
+    if (triggerWeighting)
+    {
+      delete triggerWeighting;
+      triggerWeighting = 0;
+    }
+  }
+  
+  fCentralityDistribution->Fill(centrality);
+  fCentralityCorrelation->Fill(centrality, particles->GetEntriesFast());
+  FillEvent(centrality, step);
+}
+
+//____________________________________________________________________
+TH1* AliUEHistograms::CreateTriggerWeighting(TObjArray* particles)
+{
+  // creates the histogram with the number of trigger particles per trigger pT bin in this event
+  // which is used if fWeightPerEvent is set. The caller owns the histogram
+  
+  TAxis* axis = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward)->GetGrid(0)->GetGrid()->GetAxis(2);
+  TH1* triggerWeighting = new TH1F("triggerWeighting", "", axis->GetNbins(), axis->GetXbins()->GetArray());
+
+  for (Int_t i=0; i<particles->GetEntriesFast(); i++)
+  {
+    AliVParticle* triggerParticle = (AliVParticle*) particles->UncheckedAt(i);
+    
+    // some optimization
+    Float_t triggerEta = triggerParticle->Eta();
+
+    if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
+      continue;
+
+    if (fOnlyOneEtaSide != 0)
+    {
+      if (fOnlyOneEtaSide * triggerEta < 0)
+	continue;
+    }
+    
+    if (fTriggerSelectCharge != 0)
+      if (triggerParticle->Charge() * fTriggerSelectCharge < 0)
+	continue;
+    
+    triggerWeighting->Fill(triggerParticle->Pt());
+  }
+  
+  return triggerWeighting;
+}
+
+//____________________________________________________________________
+void AliUEHistograms::FillTriggerParticle(Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, Float_t triggerEta, Double_t triggerPt, Double_t triggerPhi, TH1* triggerWeighting, Bool_t applyEfficiency)
+{
+  // fills the event histogram and the QA histograms once per trigger particle
+  
+  Double_t vars[3];
+  vars[0] = triggerPt;
+  vars[1] = centrality;
+  vars[2] = zVtx;
+
+  Double_t useWeight = 1;
+  if (fEfficiencyCorrectionTriggers && applyEfficiency)
+  {
+    Int_t effVars[4];
+    
+    // trigger particle
+    effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
+    effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[0]); //pt
+    effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[1]); //centrality
+    effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[2]); //zVtx
+    useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
+  }
+
+  if (TMath::Abs(triggerEta) < 0.8 && triggerPt > 0)
+    fInvYield2->Fill(centrality, triggerPt, useWeight / triggerPt);
+
+  if (fWeightPerEvent)
+  {
+    // leads effectively to a filling of one entry per filled trigger particle pT bin
+    Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(vars[0]);
+//     Printf("Using weight %f", triggerWeighting->GetBinContent(weightBin));
+    useWeight /= triggerWeighting->GetBinContent(weightBin);
+  }
+  
+  fNumberDensityPhi->GetEventHist()->Fill(vars, step, useWeight);
+
+  // QA
+  fCorrelationpT->Fill(centrality, triggerPt);
+  fCorrelationEta->Fill(centrality, triggerEta);
+  fCorrelationPhi->Fill(centrality, triggerPhi);
+  fYields->Fill(centrality, triggerPt, triggerEta);
+}
+
+//____________________________________________________________________
+void AliUEHistograms::PackParticles(TObjArray* list, TArrayD& pt, TArrayD& phi, TArrayF& eta, TArrayI& charge, TArrayL64* eventIndex)
+{
+  // copies the properties of the particles in list into contiguous arrays (one virtual call per particle and property)
+  // if eventIndex is given, the particles must derive from AliBasicParticle and their event index is stored as well
+  
+  Int_t n = list->GetEntriesFast();
+  if (pt.GetSize() < n)
+  {
+    pt.Set(n);
+    phi.Set(n);
+    eta.Set(n);
+    charge.Set(n);
+  }
+  if (eventIndex && eventIndex->GetSize() < n)
+    eventIndex->Set(n);
+  
+  for (Int_t i=0; i<n; i++)
+  {
+    AliVParticle* particle = (AliVParticle*) list->UncheckedAt(i);
+    pt.fArray[i] = particle->Pt();
+    phi.fArray[i] = particle->Phi();
+    eta.fArray[i] = particle->Eta();
+    charge.fArray[i] = particle->Charge();
+    
+    if (eventIndex)
+    {
+      AliBasicParticle* particleBasic = dynamic_cast<AliBasicParticle*>(particle);
+      if (!particleBasic)
       {
-        // once per trigger particle
-        Double_t vars[3];
-        vars[0] = triggerParticle->Pt();
-        vars[1] = centrality;
-	vars[2] = zVtx;
-
-	Double_t useWeight = 1;
-	if (fEfficiencyCorrectionTriggers && applyEfficiency)
+	AliFatal("If fCheckEventNumberInCorrelation is set, particle must be derived from AliBasicParticle");
+	continue;
+      }
+      eventIndex->fArray[i] = particleBasic->GetEventIndex();
+    }
+  }
+}
+
+//____________________________________________________________________
+const Double_t* AliUEHistograms::GetDPhiStarTable(Int_t list, Int_t i, Float_t pt)
+{
+  // returns the asin(0.075 * radius / pt) terms of dphistar for all radii of the two-track cut scan for particle i of list (0 = trigger, 1 = associated)
+  // they are calculated once per particle and event
+  
+  Int_t nRadii = fPairKernelRadii.GetSize();
+  Double_t* table = fPairKernelDPhiStarTable[list].GetArray() + i * nRadii;
+  if (!fPairKernelDPhiStarFilled[list].fArray[i])
+  {
+    for (Int_t k=0; k<nRadii; k++)
+      table[k] = TMath::ASin(0.075 * fPairKernelRadii.fArray[k] / pt);
+    fPairKernelDPhiStarFilled[list].fArray[i] = 1;
+  }
+  return table;
+}
+
+//____________________________________________________________________
+void AliUEHistograms::FillCorrelationsPairKernel(Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, TObjArray* particles, TObjArray* mixed, Float_t weight, Bool_t firstTime, Bool_t twoTrackEfficiencyCut, Float_t bSign, Float_t twoTrackEfficiencyCutValue, Bool_t applyEfficiency)
+{
+  // pair part of FillCorrelations working on contiguous arrays (activated with SetUsePairKernel)
+  //
+  // the particle properties are read once per event, then for each trigger particle the pair selection is done in batches
+  // over all associated particles (first the cheap selections, then conversions, resonances and the two-track cut only
+  // for the remaining candidates). The surviving pairs are collected and filled per trigger particle in the same order
+  // as in the standard loop, therefore the output is identical bin for bin
+  
+  Bool_t fillpT = kFALSE;
+  if (weight < 0)
+    fillpT = kTRUE;
+  
+  const Int_t nTrig = particles->GetEntriesFast();
+  const Int_t nAssoc = (mixed) ? mixed->GetEntriesFast() : nTrig;
+  
+  // pack particle properties
+  TArrayL64* eventIndex[2] = { 0, 0 };
+  if (fCheckEventNumberInCorrelation)
+  {
+    eventIndex[0] = &fPairKernelEventIndex[0];
+    eventIndex[1] = &fPairKernelEventIndex[1];
+  }
+  PackParticles(particles, fPairKernelPt[0], fPairKernelPhi[0], fPairKernelEta[0], fPairKernelCharge[0], eventIndex[0]);
+  if (mixed)
+    PackParticles(mixed, fPairKernelPt[1], fPairKernelPhi[1], fPairKernelEta[1], fPairKernelCharge[1], eventIndex[1]);
+  
+  const Int_t assocList = (mixed) ? 1 : 0;
+  const Double_t* trigPt = fPairKernelPt[0].GetArray();
+  const Double_t* trigPhi = fPairKernelPhi[0].GetArray();
+  const Float_t* trigEta = fPairKernelEta[0].GetArray();
+  const Int_t* trigCharge = fPairKernelCharge[0].GetArray();
+  const Double_t* assocPt = fPairKernelPt[assocList].GetArray();
+  const Double_t* assocPhi = fPairKernelPhi[assocList].GetArray();
+  const Float_t* assocEta = fPairKernelEta[assocList].GetArray();
+  const Int_t* assocCharge = fPairKernelCharge[assocList].GetArray();
+  const Long64_t* trigEventIndex = (eventIndex[0]) ? eventIndex[0]->GetArray() : 0;
+  const Long64_t* assocEventIndex = (eventIndex[assocList]) ? eventIndex[assocList]->GetArray() : 0;
+  
+  // for mixed events the trigger and associated particle must not be the same object (TObject::IsEqual)
+  // for AliBasicParticles this is a comparison of the unique IDs which are packed here, other classes are asked directly
+  Bool_t checkEqual = (mixed && !fCheckEventNumberInCorrelation);
+  TArrayC trigIsBasic;
+  TArrayI trigUniqueID, assocUniqueID;
+  if (checkEqual)
+  {
+    trigIsBasic.Set(nTrig);
+    trigUniqueID.Set(nTrig);
+    assocUniqueID.Set(nAssoc);
+    for (Int_t i=0; i<nTrig; i++)
+    {
+      trigIsBasic[i] = (dynamic_cast<AliBasicParticle*>(particles->UncheckedAt(i)) != 0);
+      trigUniqueID[i] = particles->UncheckedAt(i)->GetUniqueID();
+    }
+    for (Int_t j=0; j<nAssoc; j++)
+      assocUniqueID[j] = mixed->UncheckedAt(j)->GetUniqueID();
+  }
+  
+  TH1* triggerWeighting = 0;
+  if (fWeightPerEvent)
+    triggerWeighting = CreateTriggerWeighting(particles);
+  
+  // efficiency correction factors of the associated particles do not depend on the pair
+  TArrayD assocEfficiency;
+  if (applyEfficiency && fEfficiencyCorrectionAssociated)
+  {
+    assocEfficiency.Set(nAssoc);
+    for (Int_t j=0; j<nAssoc; j++)
+    {
+      Int_t effVars[4];
+      effVars[0] = fEfficiencyCorrectionAssociated->GetAxis(0)->FindBin(assocEta[j]);
+      effVars[1] = fEfficiencyCorrectionAssociated->GetAxis(1)->FindBin(assocPt[j]); //pt
+      effVars[2] = fEfficiencyCorrectionAssociated->GetAxis(2)->FindBin(centrality); //centrality
+      effVars[3] = fEfficiencyCorrectionAssociated->GetAxis(3)->FindBin((Double_t) zVtx); //zVtx
+      assocEfficiency[j] = fEfficiencyCorrectionAssociated->GetBinContent(effVars);
+    }
+  }
+  
+  // identify K, Lambda candidates and flag those particles (as in FillCorrelations the TObject bit is set as well)
+  const UInt_t kResonanceDaughterFlag = 1 << 14;
+  TArrayC resonanceFlag[2];
+  if (fRejectResonanceDaughters > 0)
+  {
+    Double_t resonanceMass = -1;
+    Double_t massDaughter1 = -1;
+    Double_t massDaughter2 = -1;
+    const Double_t interval = 0.02;
+    
+    switch (fRejectResonanceDaughters)
+    {
+      case 1: resonanceMass = 1.2; massDaughter1 = 0.1396; massDaughter2 = 0.9383; break; // method test
+      case 2: resonanceMass = 0.4976; massDaughter1 = 0.1396; massDaughter2 = massDaughter1; break; // k0
+      case 3: resonanceMass = 1.115; massDaughter1 = 0.1396; massDaughter2 = 0.9383; break; // lambda
+      default: AliFatal(Form("Invalid setting %d", fRejectResonanceDaughters));
+    }
+    
+    for (Int_t i=0; i<nTrig; i++)
+      particles->UncheckedAt(i)->ResetBit(kResonanceDaughterFlag);
+    if (mixed)
+      for (Int_t j=0; j<nAssoc; j++)
+	mixed->UncheckedAt(j)->ResetBit(kResonanceDaughterFlag);
+    
+    resonanceFlag[0].Set(nTrig);
+    if (mixed)
+      resonanceFlag[1].Set(nAssoc);
+    Char_t* trigFlag = resonanceFlag[0].GetArray();
+    Char_t* assocFlag = resonanceFlag[assocList].GetArray();
+    
+    for (Int_t i=0; i<nTrig; i++)
+    {
+      for (Int_t j=0; j<nAssoc; j++)
+      {
+	if (!mixed && i == j)
+	  continue;
+	
+	if (trigEventIndex)
 	{
-	  Int_t effVars[4];
+	  if (trigEventIndex[i] == assocEventIndex[j])
+	    continue;
+	}
+	else if (checkEqual)
+	{
+	  if ((trigIsBasic[i]) ? (trigUniqueID[i] == assocUniqueID[j]) : particles->UncheckedAt(i)->IsEqual(mixed->UncheckedAt(j)))
+	    continue;
+	}
+	
+	if (trigCharge[i] * assocCharge[j] > 0)
+	  continue;
+	
+	Float_t mass = GetInvMassSquaredCheap(trigPt[i], trigEta[i], trigPhi[i], assocPt[j], assocEta[j], assocPhi[j], massDaughter1, massDaughter2);
+	
+	if (TMath::Abs(mass - resonanceMass*resonanceMass) < interval*5)
+	{
+	  mass = GetInvMassSquared(trigPt[i], trigEta[i], trigPhi[i], assocPt[j], assocEta[j], assocPhi[j], massDaughter1, massDaughter2);
 	  
-	  // trigger particle
-	  effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
-	  effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(vars[0]); //pt
-	  effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(vars[1]); //centrality
-	  effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin(vars[2]); //zVtx
-	  useWeight *= fEfficiencyCorrectionTriggers->GetBinContent(effVars);
+	  if (mass > (resonanceMass-interval)*(resonanceMass-interval) && mass < (resonanceMass+interval)*(resonanceMass+interval))
+	  {
+	    trigFlag[i] = 1;
+	    assocFlag[j] = 1;
+	    particles->UncheckedAt(i)->SetBit(kResonanceDaughterFlag);
+	    ((mixed) ? mixed : particles)->UncheckedAt(j)->SetBit(kResonanceDaughterFlag);
+	  }
 	}
+      }
+    }
+  }
+  const Char_t* trigResonance = (fRejectResonanceDaughters > 0) ? resonanceFlag[0].GetArray() : 0;
+  const Char_t* assocResonance = (fRejectResonanceDaughters > 0) ? resonanceFlag[assocList].GetArray() : 0;
+  
+  // two-track cut: radii of the dphistar scan (same accumulation as in FillCorrelations) and caches of the asin terms
+  Double_t* trigAsinMinRadius = 0;
+  Double_t* trigAsinMaxRadius = 0;
+  Double_t* assocAsinMinRadius = 0;
+  Double_t* assocAsinMaxRadius = 0;
+  if (twoTrackEfficiencyCut)
+  {
+    Int_t nRadii = 0;
+    for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01)
+      nRadii++;
+    fPairKernelRadii.Set(nRadii);
+    nRadii = 0;
+    for (Double_t rad=fTwoTrackCutMinRadius; rad<2.51; rad+=0.01)
+      fPairKernelRadii[nRadii++] = rad;
+    
+    Int_t nList[2] = { nTrig, nAssoc };
+    for (Int_t list=0; list<=assocList; list++)
+    {
+      if (fPairKernelDPhiStarTable[list].GetSize() < nList[list] * nRadii)
+	fPairKernelDPhiStarTable[list].Set(nList[list] * nRadii);
+      fPairKernelDPhiStarFilled[list].Set(nList[list]);
+      fPairKernelDPhiStarFilled[list].Reset();
+      fPairKernelDPhiStarBounds[list].Set(2 * nList[list]);
+      for (Int_t i=0; i<nList[list]; i++)
+      {
+	Float_t pt = fPairKernelPt[list].fArray[i];
+	fPairKernelDPhiStarBounds[list].fArray[2*i] = TMath::ASin(0.075 * fTwoTrackCutMinRadius / pt);
+	fPairKernelDPhiStarBounds[list].fArray[2*i+1] = TMath::ASin(0.075 * (Float_t) 2.5 / pt);
+      }
+    }
+    trigAsinMinRadius = fPairKernelDPhiStarBounds[0].GetArray();
+    trigAsinMaxRadius = trigAsinMinRadius + 1;
+    assocAsinMinRadius = fPairKernelDPhiStarBounds[assocList].GetArray();
+    assocAsinMaxRadius = assocAsinMinRadius + 1;
+  }
+  const Int_t nRadii = fPairKernelRadii.GetSize();
+  
+  // candidate list and fill buffer, reused for all trigger particles
+  TArrayI candidates(nAssoc);
+  Int_t* cand = candidates.GetArray();
+  TArrayD fillVars(6 * nAssoc);
+  TArrayD fillWeights(nAssoc);
+  AliCFContainer* trackHist = fNumberDensityPhi->GetTrackHist(AliUEHist::kToward);
+  
+  for (Int_t i=0; i<nTrig; i++)
+  {
+    Float_t triggerEta = trigEta[i];
+    
+    if (fTriggerRestrictEta > 0 && TMath::Abs(triggerEta) > fTriggerRestrictEta)
+      continue;
 
-	if (TMath::Abs(triggerEta) < 0.8 && triggerParticle->Pt() > 0)
-	  fInvYield2->Fill(centrality, triggerParticle->Pt(), useWeight / triggerParticle->Pt());
+    if (fOnlyOneEtaSide != 0)
+    {
+      if (fOnlyOneEtaSide * triggerEta < 0)
+	continue;
+    }
+    
+    if (fTriggerSelectCharge != 0)
+      if (trigCharge[i] * fTriggerSelectCharge < 0)
+	continue;
+    
+    if (trigResonance && trigResonance[i])
+      continue;
+    
+    // single-particle and charge selections as branch-free compaction over all associated particles
+    const Double_t triggerPt = trigPt[i];
+    const Int_t triggerCharge = trigCharge[i];
+    Int_t nCand = 0;
+    for (Int_t j=0; j<nAssoc; j++)
+    {
+      Int_t pairCharge = assocCharge[j] * triggerCharge;
+      Bool_t accept = (mixed || i != j);
+      accept &= (!fPtOrder || assocPt[j] < triggerPt);
+      accept &= (fAssociatedSelectCharge == 0 || assocCharge[j] * fAssociatedSelectCharge >= 0);
+      accept &= (fSelectCharge != 1 || pairCharge <= 0);
+      accept &= (fSelectCharge != 2 || pairCharge >= 0);
+      accept &= (!fEtaOrdering || !((triggerEta < 0 && assocEta[j] < triggerEta) || (triggerEta > 0 && assocEta[j] > triggerEta)));
+      accept &= (!assocResonance || !assocResonance[j]);
+      cand[nCand] = j;
+      nCand += accept;
+    }
+    
+    // same event / same object
+    if (trigEventIndex || checkEqual)
+    {
+      Int_t nKeep = 0;
+      for (Int_t k=0; k<nCand; k++)
+      {
+	Int_t j = cand[k];
+	Bool_t same = kFALSE;
+	if (trigEventIndex)
+	  same = (trigEventIndex[i] == assocEventIndex[j]);
+	else
+	  same = (trigIsBasic[i]) ? (trigUniqueID[i] == assocUniqueID[j]) : particles->UncheckedAt(i)->IsEqual(mixed->UncheckedAt(j));
+	cand[nKeep] = j;
+	nKeep += !same;
+      }
+      nCand = nKeep;
+    }
+    
+    // conversions
+    if (fCutConversionsV > 0)
+    {
+      Int_t nKeep = 0;
+      for (Int_t k=0; k<nCand; k++)
+      {
+	Int_t j = cand[k];
+	Bool_t reject = kFALSE;
+	if (assocCharge[j] * triggerCharge < 0)
+	{
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, trigPhi[i], assocPt[j], assocEta[j], assocPhi[j], 0.510e-3, 0.510e-3);
+	  
+	  if (mass < fCutConversionsV * 5)
+	  {
+	    mass = GetInvMassSquared(triggerPt, triggerEta, trigPhi[i], assocPt[j], assocEta[j], assocPhi[j], 0.510e-3, 0.510e-3);
+	    
+	    fControlConvResoncances->Fill(0.0, mass);
 
-	if (fWeightPerEvent)
+	    reject = (mass < fCutConversionsV*fCutConversionsV);
+	  }
+	}
+	cand[nKeep] = j;
+	nKeep += !reject;
+      }
+      nCand = nKeep;
+    }
+    
+    if (fCutResonancesV > 0)
+    {
+      // K0s
+      const Float_t kK0smass = 0.4976;
+      Int_t nKeep = 0;
+      for (Int_t k=0; k<nCand; k++)
+      {
+	Int_t j = cand[k];
+	Bool_t reject = kFALSE;
+	if (assocCharge[j] * triggerCharge < 0)
 	{
-	  // leads effectively to a filling of one entry per filled trigger particle pT bin
-	  Int_t weightBin = triggerWeighting->GetXaxis()->FindBin(vars[0]);
-// 	  Printf("Using weight %f", triggerWeighting->GetBinContent(weightBin));
-	  useWeight /= triggerWeighting->GetBinContent(weightBin);
+	  Float_t mass = GetInvMassSquaredCheap(triggerPt, triggerEta, trigPhi[i], assocPt[j], assocEta[j], assocPhi[j], 0.1396, 0.1396);
+	  
+	  if (TMath::Abs(mass - kK0smass*kK0smass) < fCutResonancesV * 5)
+	  {
+	    mass = GetInvMassSquared(triggerPt, triggerEta, trigPhi[i], assocPt[j], assocEta[j], assocPhi[j], 0.1396, 0.1396);
+	    
+	    fControlConvResoncances->Fill(1, mass - kK0smass*kK0smass);
+
+	    reject = (mass > (kK0smass-fCutResonancesV)*(kK0smass-fCutResonancesV) && mass < (kK0smass+fCutResonancesV)*(kK0smass+fCutResonancesV));
+	  }
 	}
-	
-        fNumberDensityPhi->GetEventHist()->Fill(vars, step, useWeight);
+	cand[nKeep] = j;
+	nKeep += !reject;
+      }
+      nCand = nKeep;
+      
+      // Lambda
+      const Float_t kLambdaMass = 1.115;
+      nKeep = 0;
+      for (Int_t k=0; k<nCand; k++)
+      {
+	Int_t j = cand[k];
+	Bool_t reject = kFALSE;
+	if (assocCharge[j] * triggerCharge < 0)
+	{
+	  Float_t mass1 = GetInvMassSquaredCheap(triggerPt, triggerEta, trigPhi[i], assocPt[j], assocEta[j], assocPhi[j], 0.1396, 0.9383);
+	  Float_t mass2 = GetInvMassSquaredCheap(triggerPt, triggerEta, trigPhi[i], assocPt[j], assocEta[j], assocPhi[j], 0.9383, 0.1396);
+	  
+	  if (TMath::Abs(mass1 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
+	  {
+	    mass1 = GetInvMassSquared(triggerPt, triggerEta, trigPhi[i], assocPt[j], assocEta[j], assocPhi[j], 0.1396, 0.9383);
+
+	    fControlConvResoncances->Fill(2, mass1 - kLambdaMass*kLambdaMass);
+	    
+	    reject = (mass1 > (kLambdaMass-fCutResonancesV)*(kLambdaMass-fCutResonancesV) && mass1 < (kLambdaMass+fCutResonancesV)*(kLambdaMass+fCutResonancesV));
+	  }
+	  if (!reject && TMath::Abs(mass2 - kLambdaMass*kLambdaMass) < fCutResonancesV * 5)
+	  {
+	    mass2 = GetInvMassSquared(triggerPt, triggerEta, trigPhi[i], assocPt[j], assocEta[j], assocPhi[j], 0.9383, 0.1396);
+
+	    fControlConvResoncances->Fill(2, mass2 - kLambdaMass*kLambdaMass);
 
-	// QA
-        fCorrelationpT->Fill(centrality, triggerParticle->Pt());
-        fCorrelationEta->Fill(centrality, triggerEta);
-        fCorrelationPhi->Fill(centrality, triggerParticle->Phi());
-	fYields->Fill(centrality, triggerParticle->Pt(), triggerEta);
+	    reject = (mass2 > (kLambdaMass-fCutResonancesV)*(kLambdaMass-fCutResonancesV) && mass2 < (kLambdaMass+fCutResonancesV)*(kLambdaMass+fCutResonancesV));
+	  }
+	}
+	cand[nKeep] = j;
+	nKeep += !reject;
+      }
+      nCand = nKeep;
+    }
+    
+    if (twoTrackEfficiencyCut)
+    {
+      // see FillCorrelations for the definition of the cut; the asin terms come from the per-particle caches
+      Float_t phi1 = trigPhi[i];
+      Float_t pt1 = triggerPt;
+      Float_t charge1 = triggerCharge;
+      const Float_t kLimit = twoTrackEfficiencyCutValue * 3;
+      
+      Int_t nKeep = 0;
+      for (Int_t k=0; k<nCand; k++)
+      {
+	Int_t j = cand[k];
+	Bool_t reject = kFALSE;
+	Float_t deta = triggerEta - assocEta[j];
 	
-/*        if (dynamic_cast<AliAODTrack*>(triggerParticle))
-          fITSClusterMap->Fill(((AliAODTrack*) triggerParticle)->GetITSClusterMap(), centrality, triggerParticle->Pt());*/
+	if (TMath::Abs(deta) < twoTrackEfficiencyCutValue * 2.5 * 3)
+	{
+	  Float_t phi2 = assocPhi[j];
+	  Float_t pt2 = assocPt[j];
+	  Float_t charge2 = assocCharge[j];
+	  
+	  Float_t dphistar1 = GetDPhiStarFromAsin(phi1, charge1, trigAsinMinRadius[2*i], phi2, charge2, assocAsinMinRadius[2*j], bSign);
+	  Float_t dphistar2 = GetDPhiStarFromAsin(phi1, charge1, trigAsinMaxRadius[2*i], phi2, charge2, assocAsinMaxRadius[2*j], bSign);
+	  
+	  if (TMath::Abs(dphistar1) < kLimit || TMath::Abs(dphistar2) < kLimit || dphistar1 * dphistar2 < 0)
+	  {
+	    const Double_t* asin1 = GetDPhiStarTable(0, i, pt1);
+	    const Double_t* asin2 = GetDPhiStarTable(assocList, j, pt2);
+	    
+	    Float_t dphistarminabs = 1e5;
+	    Float_t dphistarmin = 1e5;
+	    for (Int_t r=0; r<nRadii; r++)
+	    {
+	      Float_t dphistar = GetDPhiStarFromAsin(phi1, charge1, asin1[r], phi2, charge2, asin2[r], bSign);
+	      
+	      Float_t dphistarabs = TMath::Abs(dphistar);
+	      
+	      if (dphistarabs < dphistarminabs)
+	      {
+		dphistarmin = dphistar;
+		dphistarminabs = dphistarabs;
+	      }
+	    }
+	    
+	    fTwoTrackDistancePt[0]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
+	    
+	    if (dphistarminabs < twoTrackEfficiencyCutValue && TMath::Abs(deta) < twoTrackEfficiencyCutValue)
+	      reject = kTRUE;
+	    else
+	      fTwoTrackDistancePt[1]->Fill(deta, dphistarmin, TMath::Abs(pt1 - pt2));
+	  }
+	}
+	cand[nKeep] = j;
+	nKeep += !reject;
       }
+      nCand = nKeep;
     }
     
-    if (triggerWeighting)
+    // trigger-dependent weight factors
+    Double_t triggerEfficiency = 1;
+    Bool_t useTriggerEfficiency = (applyEfficiency && fEfficiencyCorrectionTriggers);
+    if (useTriggerEfficiency)
     {
-      delete triggerWeighting;
-      triggerWeighting = 0;
+      Int_t effVars[4];
+      effVars[0] = fEfficiencyCorrectionTriggers->GetAxis(0)->FindBin(triggerEta);
+      effVars[1] = fEfficiencyCorrectionTriggers->GetAxis(1)->FindBin(triggerPt); //pt
+      effVars[2] = fEfficiencyCorrectionTriggers->GetAxis(2)->FindBin(centrality); //centrality
+      effVars[3] = fEfficiencyCorrectionTriggers->GetAxis(3)->FindBin((Double_t) zVtx); //zVtx
+      triggerEfficiency = fEfficiencyCorrectionTriggers->GetBinContent(effVars);
     }
+    Double_t triggerWeight = 1;
+    if (fWeightPerEvent)
+      triggerWeight = triggerWeighting->GetBinContent(triggerWeighting->GetXaxis()->FindBin(triggerPt));
+    
+    // collect variables of the accepted pairs and fill them
+    Double_t* vars = fillVars.GetArray();
+    Double_t* weights = fillWeights.GetArray();
+    for (Int_t k=0; k<nCand; k++)
+    {
+      Int_t j = cand[k];
+      Double_t* pairVars = vars + 6 * k;
+      pairVars[0] = triggerEta - assocEta[j];
+      pairVars[1] = assocPt[j];
+      pairVars[2] = triggerPt;
+      pairVars[3] = centrality;
+      pairVars[4] = trigPhi[i] - assocPhi[j];
+      if (pairVars[4] > 1.5 * TMath::Pi()) 
+	pairVars[4] -= TMath::TwoPi();
+      if (pairVars[4] < -0.5 * TMath::Pi())
+	pairVars[4] += TMath::TwoPi();
+      pairVars[5] = zVtx;
+      
+      if (fillpT)
+	weight = assocPt[j];
+      
+      Double_t useWeight = weight;
+      if (applyEfficiency)
+      {
+	if (fEfficiencyCorrectionAssociated)
+	  useWeight *= assocEfficiency.fArray[j];
+	if (useTriggerEfficiency)
+	  useWeight *= triggerEfficiency;
+      }
+      if (fWeightPerEvent)
+	useWeight /= triggerWeight;
+      
+      weights[k] = useWeight;
+    }
+    
+    // fill all in toward region and do not use the other regions
+    for (Int_t k=0; k<nCand; k++)
+      trackHist->Fill(vars + 6 * k, step, weights[k]);
+    
+    if (firstTime)
+      FillTriggerParticle(centrality, zVtx, step, triggerEta, triggerPt, trigPhi[i], triggerWeighting, applyEfficiency);
   }
   
-  fCentralityDistribution->Fill(centrality);
-  fCentralityCorrelation->Fill(centrality, particles->GetEntriesFast());
-  FillEvent(centrality, step);
+  if (triggerWeighting)
+  {
+    delete triggerWeighting;
+    triggerWeighting = 0;
+  }
 }
   
 //____________________________________________________________________
@@ -1281,6 +1822,7 @@ void AliUEHistograms::Copy(TObject& c) const
   target.fPtOrder = fPtOrder;
   target.fTwoTrackCutMinRadius = fTwoTrackCutMinRadius;
   target.fCheckEventNumberInCorrelation = fCheckEventNumberInCorrelation;
+  target.fUsePairKernel = fUsePairKernel;
 }
 
 //____________________________________________________________________
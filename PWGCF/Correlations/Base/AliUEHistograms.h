@@ -12,6 +12,11 @@
 #include "AliUEHist.h"
 #include "TMath.h"
 #include "THn.h" // in cxx file causes .../THn.h:257: error: conflicting declaration ‘typedef class THnT<float> THnF’
+#include "TArrayC.h"
+#include "TArrayD.h"
+#include "TArrayF.h"
+#include "TArrayI.h"
+#include "TArrayL64.h"
 
 class AliVParticle;
 
@@ -21,6 +26,7 @@ class TObjArray;
 class TH1F;
 class TH2F;
 class TH3F;
+class TH1;
 
 class AliUEHistograms : public TNamed
 {
@@ -94,6 +100,7 @@ class AliUEHistograms : public TNamed
   void SetOnlyOneEtaSide(Int_t flag)    { fOnlyOneEtaSide = flag; }
   void SetPtOrder(Bool_t flag) { fPtOrder = flag; }
   void SetTwoTrackCutMinRadius(Float_t min) { fTwoTrackCutMinRadius = min; }
+  void SetUsePairKernel(Bool_t flag) { fUsePairKernel = flag; }
 
   void SetCheckEventNumberInCorrelation(Bool_t val) { fCheckEventNumberInCorrelation = val; }
   void ExtendTrackingEfficiency(Bool_t verbose = kFALSE);
@@ -110,9 +117,15 @@ protected:
   void FillRegion(AliUEHist::Region region, Float_t zVtx, AliUEHist::CFStep step, AliVParticle* leading, TList* list, Int_t multiplicity);
   Int_t CountParticles(TList* list, Float_t ptMin);
   void DeleteContainers();
+  void FillCorrelationsPairKernel(Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, TObjArray* particles, TObjArray* mixed, Float_t weight, Bool_t firstTime, Bool_t twoTrackEfficiencyCut, Float_t bSign, Float_t twoTrackEfficiencyCutValue, Bool_t applyEfficiency);
+  TH1* CreateTriggerWeighting(TObjArray* particles);
+  void FillTriggerParticle(Double_t centrality, Float_t zVtx, AliUEHist::CFStep step, Float_t triggerEta, Double_t triggerPt, Double_t triggerPhi, TH1* triggerWeighting, Bool_t applyEfficiency);
+  void PackParticles(TObjArray* list, TArrayD& pt, TArrayD& phi, TArrayF& eta, TArrayI& charge, TArrayL64* eventIndex);
+  const Double_t* GetDPhiStarTable(Int_t list, Int_t i, Float_t pt);
   inline Float_t GetInvMassSquared(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetInvMassSquaredCheap(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2);
   inline Float_t GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign);
+  inline Float_t GetDPhiStarFromAsin(Float_t phi1, Float_t charge1, Double_t asin1, Float_t phi2, Float_t charge2, Double_t asin2, Float_t bSign);
   
   static const Int_t fgkUEHists; // number of histograms
 
@@ -158,12 +171,23 @@ protected:
   Float_t fTwoTrackCutMinRadius; // min radius for TTR cut
 
   Bool_t fCheckEventNumberInCorrelation; // do not correlate two particles from the same event (only works for AliBasicParticles)
+  Bool_t fUsePairKernel;         // use FillCorrelationsPairKernel (structure-of-arrays pair loop) in FillCorrelations
+
+  TArrayD fPairKernelPt[2];             //! pair kernel: packed pT of trigger (0) and associated (1) particles
+  TArrayD fPairKernelPhi[2];            //! pair kernel: packed phi
+  TArrayF fPairKernelEta[2];            //! pair kernel: packed eta
+  TArrayI fPairKernelCharge[2];         //! pair kernel: packed charge
+  TArrayL64 fPairKernelEventIndex[2];   //! pair kernel: packed event index (fCheckEventNumberInCorrelation)
+  TArrayF fPairKernelRadii;             //! pair kernel: radii of the dphistar scan of the two-track cut
+  TArrayD fPairKernelDPhiStarTable[2];  //! pair kernel: asin terms of dphistar per particle and radius
+  TArrayC fPairKernelDPhiStarFilled[2]; //! pair kernel: flags which particles have their asin terms calculated
+  TArrayD fPairKernelDPhiStarBounds[2]; //! pair kernel: asin terms at the minimal radius and at 2.5 m
 
   Long64_t fRunNumber;           // run number that has been processed
   
   Int_t fMergeCount;		// counts how many objects have been merged together
   
-  ClassDef(AliUEHistograms, 31)  // underlying event histogram container
+  ClassDef(AliUEHistograms, 32)  // underlying event histogram container
 };
 
 Float_t AliUEHistograms::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1, Float_t phi2, Float_t pt2, Float_t charge2, Float_t radius, Float_t bSign)
@@ -192,6 +216,26 @@ Float_t AliUEHistograms::GetDPhiStar(Float_t phi1, Float_t pt1, Float_t charge1,
   return dphistar;
 }
 
+Float_t AliUEHistograms::GetDPhiStarFromAsin(Float_t phi1, Float_t charge1, Double_t asin1, Float_t phi2, Float_t charge2, Double_t asin2, Float_t bSign)
+{ 
+  //
+  // calculates dphistar as GetDPhiStar with precalculated TMath::ASin(0.075 * radius / pt) terms
+  //
+  
+  Float_t dphistar = phi1 - phi2 - charge1 * bSign * asin1 + charge2 * bSign * asin2;
+  
+  static const Double_t kPi = TMath::Pi();
+  
+  if (dphistar > kPi)
+    dphistar = kPi * 2 - dphistar;
+  if (dphistar < -kPi)
+    dphistar = -kPi * 2 - dphistar;
+  if (dphistar > kPi) // might look funny but is needed
+    dphistar = kPi * 2 - dphistar;
+  
+  return dphistar;
+}
+
 Float_t AliUEHistograms::GetInvMassSquared(Float_t pt1, Float_t eta1, Float_t phi1, Float_t pt2, Float_t eta2, Float_t phi2, Float_t m0_1, Float_t m0_2)
 {
   // calculate inv mass squared
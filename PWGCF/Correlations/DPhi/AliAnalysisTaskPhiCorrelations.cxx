@@ -104,6 +104,7 @@ fMixingTracks(50000),
 fTwoTrackEfficiencyStudy(kFALSE),
 fTwoTrackEfficiencyCut(0),
 fTwoTrackCutMinRadius(0.8),
+fUsePairKernel(kFALSE),
 fUseVtxAxis(kFALSE),
 fCourseCentralityBinning(kFALSE),
 fSkipTrigger(kFALSE),
@@ -343,6 +344,9 @@ void  AliAnalysisTaskPhiCorrelations::CreateOutputObjects()
   fHistos->SetTwoTrackCutMinRadius(fTwoTrackCutMinRadius);
   fHistosMixed->SetTwoTrackCutMinRadius(fTwoTrackCutMinRadius);
   
+  fHistos->SetUsePairKernel(fUsePairKernel);
+  fHistosMixed->SetUsePairKernel(fUsePairKernel);
+  
   if (fEfficiencyCorrectionTriggers)
    {
     fHistos->SetEfficiencyCorrectionTriggers(fEfficiencyCorrectionTriggers);
@@ -572,6 +576,7 @@ void  AliAnalysisTaskPhiCorrelations::AddSettingsTree()
   settingsTree->Branch("fUseNewCentralityFramework", &fUseNewCentralityFramework,"fUseNewCentralityFramework/O");
   settingsTree->Branch("fTwoTrackEfficiencyCut", &fTwoTrackEfficiencyCut,"TwoTrackEfficiencyCut/D");
   settingsTree->Branch("fTwoTrackCutMinRadius", &fTwoTrackCutMinRadius,"TwoTrackCutMinRadius/D");
+  settingsTree->Branch("fUsePairKernel", &fUsePairKernel,"UsePairKernel/O");
   
   //fCustomBinning
   
@@ -75,6 +75,7 @@ public:
   virtual	void    SetMixingTracks(Int_t tracks) { fMixingTracks = tracks; }
   virtual	void	SetTwoTrackEfficiencyStudy(Bool_t flag) { fTwoTrackEfficiencyStudy = flag; }
   virtual	void	SetTwoTrackEfficiencyCut(Float_t value = 0.02, Float_t min = 0.8) { fTwoTrackEfficiencyCut = value; fTwoTrackCutMinRadius = min; }
+  virtual	void	SetUsePairKernel(Bool_t flag) { fUsePairKernel = flag; }
   virtual	void	SetUseVtxAxis(Int_t flag) { fUseVtxAxis = flag; }
   virtual	void	SetCourseCentralityBinning(Bool_t flag) { fCourseCentralityBinning = flag; }
   virtual     void    SetSkipTrigger(Bool_t flag) { fSkipTrigger = flag; }
@@ -209,6 +210,7 @@ private:
   Bool_t		fTwoTrackEfficiencyStudy; // two-track efficiency study on
   Float_t		fTwoTrackEfficiencyCut;   // enable two-track efficiency cut
   Float_t		fTwoTrackCutMinRadius;    // minimum radius for two-track efficiency cut
+  Bool_t		fUsePairKernel;		  // use the structure-of-arrays pair loop of AliUEHistograms (identical output)
   Int_t		fUseVtxAxis;              // use z vtx as axis (needs 7-10 times more memory!)
   Bool_t		fCourseCentralityBinning; // less centrality bins
   Bool_t		fSkipTrigger;		  // skip trigger selection
@@ -317,7 +319,7 @@ private:
   Bool_t                      fUsePtBinnedEventPool; // uses event pool in pt bins
   Bool_t                      fCheckEventNumberInMixedEvent; // check event number before correlation in mixed event
 
-  ClassDef(AliAnalysisTaskPhiCorrelations, 62); // Analysis task for delta phi correlations
+  ClassDef(AliAnalysisTaskPhiCorrelations, 63); // Analysis task for delta phi correlations
 };
 
 #endif
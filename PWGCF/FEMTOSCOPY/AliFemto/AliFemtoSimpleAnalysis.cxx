@@ -13,6 +13,7 @@
 #include <string>
 #include <iostream>
 #include <iterator>
+#include <cmath>
 
 #ifdef __ROOT__
   /// \cond CLASSIMP
@@ -171,7 +172,16 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis():
   fMinSizePartCollection(0),
   fVerbose(kTRUE),
   fPerformSharedDaughterCut(kFALSE),
-  fEnablePairMonitors(kFALSE)
+  fEnablePairMonitors(kFALSE),
+  fPrefilterKTMin(0.0),
+  fPrefilterKTMax(0.0),
+  fPrefilterQinvMax(0.0),
+  fPrefilterDEta(0.0),
+  fPrefilterDPhiStar(0.0),
+  fPrefilterRadius(1.2),
+  fMagSign(1.0),
+  fPackedParticles(),
+  fPairCandidates()
 {
   // Default constructor
   fCorrFctnCollection = new AliFemtoCorrFctnCollection;
@@ -193,7 +203,16 @@ AliFemtoSimpleAnalysis::AliFemtoSimpleAnalysis(const AliFemtoSimpleAnalysis& a):
   fMinSizePartCollection(a.fMinSizePartCollection),
   fVerbose(a.fVerbose),
   fPerformSharedDaughterCut(a.fPerformSharedDaughterCut),
-  fEnablePairMonitors(a.fEnablePairMonitors)
+  fEnablePairMonitors(a.fEnablePairMonitors),
+  fPrefilterKTMin(a.fPrefilterKTMin),
+  fPrefilterKTMax(a.fPrefilterKTMax),
+  fPrefilterQinvMax(a.fPrefilterQinvMax),
+  fPrefilterDEta(a.fPrefilterDEta),
+  fPrefilterDPhiStar(a.fPrefilterDPhiStar),
+  fPrefilterRadius(a.fPrefilterRadius),
+  fMagSign(1.0),
+  fPackedParticles(),
+  fPairCandidates()
 {
   /// Copy constructor
 
@@ -390,6 +409,12 @@ AliFemtoSimpleAnalysis& AliFemtoSimpleAnalysis::operator=(const AliFemtoSimpleAn
   fVerbose = aAna.fVerbose;
   fPerformSharedDaughterCut = aAna.fPerformSharedDaughterCut;
   fEnablePairMonitors = aAna.fEnablePairMonitors;
+  fPrefilterKTMin = aAna.fPrefilterKTMin;
+  fPrefilterKTMax = aAna.fPrefilterKTMax;
+  fPrefilterQinvMax = aAna.fPrefilterQinvMax;
+  fPrefilterDEta = aAna.fPrefilterDEta;
+  fPrefilterDPhiStar = aAna.fPrefilterDPhiStar;
+  fPrefilterRadius = aAna.fPrefilterRadius;
 
   return *this;
 }
@@ -523,7 +548,7 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
     collection2 = nullptr;
   }
 
-  MakePairs("real", collection1, collection2, EnablePairMonitors());
+  MakePairs(kRealPair, collection1, collection2, EnablePairMonitors());
 
   if (fVerbose) {
     cout << "AliFemtoSimpleAnalysis::ProcessEvent() - reals done ";
@@ -534,15 +559,15 @@ void AliFemtoSimpleAnalysis::ProcessEvent(const AliFemtoEvent* hbtEvent)
 
     // If identical - only mix the first particle collections
     if (AnalyzeIdenticalParticles()) {
-      MakePairs("mixed", collection1, storedEvent->FirstParticleCollection());
+      MakePairs(kMixedPair, collection1, storedEvent->FirstParticleCollection());
 
     // If non-identical - mix both combinations of first and second particles
     } else {
-        MakePairs("mixed", collection1,
-                           storedEvent->SecondParticleCollection());
+        MakePairs(kMixedPair, collection1,
+                              storedEvent->SecondParticleCollection());
 
-        MakePairs("mixed", storedEvent->FirstParticleCollection(),
-                           collection2);
+        MakePairs(kMixedPair, storedEvent->FirstParticleCollection(),
+                              collection2);
     }
   }
 
@@ -569,74 +594,212 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
                                        AliFemtoParticleCollection *partCollection2,
                                        Bool_t enablePairMonitors)
 {
+/// Translates the pair type string and calls MakePairs(PairType, ...)
+
+  const string type = typeIn;
+
+  if (type == "real") {
+    MakePairs(kRealPair, partCollection1, partCollection2, enablePairMonitors);
+  } else if (type == "mixed") {
+    MakePairs(kMixedPair, partCollection1, partCollection2, enablePairMonitors);
+  } else {
+    cout << "Problem with pair type, type = " << type << endl;
+  }
+}
+//_________________________
+void AliFemtoSimpleAnalysis::PackedParticles::Fill(const AliFemtoParticleCollection &collection,
+                                                   bool withKinematics)
+{
+  /// Copy particle pointers (and kinematics if requested) into the arrays
+
+  const size_t n = collection.size();
+  fParticle.assign(collection.begin(), collection.end());
+
+  if (!withKinematics) {
+    return;
+  }
+
+  fPx.resize(n);
+  fPy.resize(n);
+  fPz.resize(n);
+  fE.resize(n);
+  fEta.resize(n);
+  fPhi.resize(n);
+  fPt.resize(n);
+  fCharge.resize(n);
+
+  for (size_t i = 0; i < n; i++) {
+    const AliFemtoLorentzVector &p = fParticle[i]->FourMomentum();
+    fPx[i] = p.px();
+    fPy[i] = p.py();
+    fPz[i] = p.pz();
+    fE[i] = p.e();
+    fPt[i] = p.Perp();
+    fEta[i] = p.PseudoRapidity();
+    fPhi[i] = p.Phi();
+    fCharge[i] = fParticle[i]->Track() ? fParticle[i]->Track()->Charge() : 0;
+  }
+}
+//_________________________
+size_t AliFemtoSimpleAnalysis::PrefilterPairs(const PackedParticles &packed1, size_t i,
+                                              const PackedParticles &packed2, size_t jmin, size_t jmax)
+{
+  /// Evaluate the kinematic prefilter for one particle against a range of
+  /// partners. The loop body has no calls (except for the rare dphistar
+  /// evaluation of close pairs) so that it can be vectorized.
+
+  const double px1 = packed1.fPx[i],
+               py1 = packed1.fPy[i],
+               pz1 = packed1.fPz[i],
+               e1 = packed1.fE[i],
+               eta1 = packed1.fEta[i];
+
+  const double *px2 = packed2.fPx.data(),
+               *py2 = packed2.fPy.data(),
+               *pz2 = packed2.fPz.data(),
+               *e2 = packed2.fE.data(),
+               *eta2 = packed2.fEta.data();
+
+  const bool cutKT = fPrefilterKTMax > fPrefilterKTMin,
+             cutQinv = fPrefilterQinvMax > 0.0,
+             cutMerging = fPrefilterDEta > 0.0;
+
+  // (2 kT)^2 and qinv^2 windows, so no sqrt is needed in the loop
+  const double kt2min = 4.0 * fPrefilterKTMin * fPrefilterKTMin,
+               kt2max = 4.0 * fPrefilterKTMax * fPrefilterKTMax,
+               qinv2max = fPrefilterQinvMax * fPrefilterQinvMax;
+
+  fPairCandidates.resize(jmax - jmin);
+  size_t *candidates = fPairCandidates.data();
+  size_t ncandidates = 0;
+
+  for (size_t j = jmin; j < jmax; j++) {
+    const double sx = px1 + px2[j],
+                 sy = py1 + py2[j],
+                 dx = px1 - px2[j],
+                 dy = py1 - py2[j],
+                 dz = pz1 - pz2[j],
+                 de = e1 - e2[j];
+
+    const double kt2 = sx * sx + sy * sy,
+                 q2 = dx * dx + dy * dy + dz * dz - de * de;
+
+    const bool passKin = (!cutKT || (kt2 >= kt2min && kt2 < kt2max))
+                      && (!cutQinv || q2 < qinv2max);
+    const bool closeEta = cutMerging && std::fabs(eta1 - eta2[j]) < fPrefilterDEta;
+
+    candidates[ncandidates] = j;
+    ncandidates += (passKin && !closeEta);
+
+    // close in eta: dphistar (as in AliFemtoCorrFctnDPhiStarDEta) decides
+    if (passKin && closeEta) {
+      const int chg1 = packed1.fCharge[i],
+                chg2 = packed2.fCharge[j];
+      if (chg1 == 0 || chg2 == 0) {
+        ncandidates++;
+        continue;
+      }
+      const double afsi1 = -0.07510020733 * chg1 * fMagSign * fPrefilterRadius / packed1.fPt[i],
+                   afsi2 = -0.07510020733 * chg2 * fMagSign * fPrefilterRadius / packed2.fPt[j];
+      if (std::fabs(afsi1) > 1.0 || std::fabs(afsi2) > 1.0) {
+        ncandidates++;
+        continue;
+      }
+      const double dphistar = packed2.fPhi[j] - packed1.fPhi[i] + std::asin(afsi2) - std::asin(afsi1);
+      ncandidates += (std::fabs(dphistar) >= fPrefilterDPhiStar);
+    }
+  }
+
+  return ncandidates;
+}
+//_________________________
+void AliFemtoSimpleAnalysis::MakePairs(PairType type,
+                                       AliFemtoParticleCollection *partCollection1,
+                                       AliFemtoParticleCollection *partCollection2,
+                                       Bool_t enablePairMonitors)
+{
 /// Build pairs, check pair cuts, and call CFs' AddRealPair() or
 /// AddMixedPair() methods. If no second particle collection is
 /// specfied, make pairs within first particle collection.
+///
+/// The particle collections are copied into arrays first, so the pair
+/// loops run over indices. If the kinematic prefilter is enabled, the
+/// partners of each particle are checked in one batch and only the
+/// survivors are passed on to the pair cut. Pairs are built in the same
+/// order (and with the same particle swapping) as without prefilter.
 
-  const string type = typeIn;
-
-  //  int swpart = ((long int) partCollection1) % 2;
+  // the correlation function method is resolved once, not per pair
+  void (AliFemtoCorrFctn::*addPair)(AliFemtoPair*) = (type == kRealPair)
+                                                   ? &AliFemtoCorrFctn::AddRealPair
+                                                   : &AliFemtoCorrFctn::AddMixedPair;
 
   // Used to swap particle 1 & 2 in identical-particle analysis
   // to avoid any implicit ordering in the event collection
   // "Seed" this here.
   bool swpart = fNeventsProcessed % 2;
 
-  // Setup iterator ranges
-  //
-  // The outer loop alway starts at beginning of particle collection 1.
-  // * If we are iterating over both particle collections, then the loop simply
-  // runs through both from beginning to end.
-  // * If we are only iterating over one particle collection, the inner loop
-  // loops over all particles between the outer iterator and the end of the
-  // collection. The outer loop must skip the last entry of the list.
-  AliFemtoParticleConstIterator tStartOuterLoop = partCollection1->begin(),
-                                tEndOuterLoop = partCollection1->end(),
-                                tStartInnerLoop,
-                                tEndInnerLoop;
+  const bool prefilter = UsePairPrefilter();
 
-  if (partCollection2) {                         // Two collections:
-    tStartInnerLoop = partCollection2->begin();  //   Full inner & outer loops
-    tEndInnerLoop   = partCollection2->end();    //
-  }
-  else {                                         // One collection:
-    tEndOuterLoop--;                             //   Outer loop goes to next-to-last particle
-    tEndInnerLoop = partCollection1->end() ;     //   Inner loop goes to last particle
+  PackedParticles &packed1 = fPackedParticles[0],
+                  &packed2 = fPackedParticles[1];
+
+  packed1.Fill(*partCollection1, prefilter);
+  if (partCollection2) {
+    packed2.Fill(*partCollection2, prefilter);
   }
 
+  // Identical particles: inner loop runs over the particles after the
+  // current one within the same collection
+  const PackedParticles &inner = partCollection2 ? packed2 : packed1;
+  const size_t nOuter = packed1.fParticle.size(),
+               nInner = inner.fParticle.size();
+
   // Create the pair outside the loop - only allocate once
   AliFemtoPair* tPair = new AliFemtoPair;
 
-  // Begin the outer loop
-  for (AliFemtoParticleConstIterator tPartIter1 = tStartOuterLoop;
-                                     tPartIter1 != tEndOuterLoop;
-                                     ++tPartIter1) {
+  for (size_t i = 0; i < nOuter; i++) {
+
+    const size_t jmin = partCollection2 ? 0 : i + 1;
+    if (jmin >= nInner) {
+      continue;
+    }
 
-    // If analyzing identical particles, start inner loop at the particle
-    // after the current outer loop position, (loops until end)
+    // swapping state of the first inner iteration; without second collection
+    // it toggles with every pair that is looked at, passing or not
+    const bool swpartFirst = swpart;
     if (!partCollection2) {
-      tStartInnerLoop = tPartIter1;
-      tStartInnerLoop++;
+      swpart = ((nInner - jmin) % 2) ? !swpart : swpart;
+    }
+
+    // partners to look at
+    size_t ncandidates;
+    if (prefilter) {
+      ncandidates = PrefilterPairs(packed1, i, inner, jmin, nInner);
+    } else {
+      ncandidates = nInner - jmin;
+    }
+
+    if (ncandidates == 0) {
+      continue;
     }
 
     // If we have two collections - set the first track
     if (partCollection2 != nullptr) {
-      tPair->SetTrack1(*tPartIter1);
+      tPair->SetTrack1(packed1.fParticle[i]);
     }
 
-    // Begin the inner loop
-    for (AliFemtoParticleConstIterator tPartIter2 = tStartInnerLoop;
-                                       tPartIter2 != tEndInnerLoop;
-                                     ++tPartIter2) {
+    for (size_t k = 0; k < ncandidates; k++) {
+      const size_t j = prefilter ? fPairCandidates[k] : jmin + k;
+
       // If we have two collections - only set the second track
       if (partCollection2 != nullptr) {
-        tPair->SetTrack2(*tPartIter2);
+        tPair->SetTrack2(inner.fParticle[j]);
 
       // Swap between first and second particles to avoid biased ordering
       } else {
-        tPair->SetTrack1(swpart ? *tPartIter2 : *tPartIter1);
-        tPair->SetTrack2(swpart ? *tPartIter1 : *tPartIter2);
-        swpart = !swpart;
+        const bool swap = ((j - jmin) % 2) ? !swpartFirst : swpartFirst;
+        tPair->SetTrack1(swap ? inner.fParticle[j] : packed1.fParticle[i]);
+        tPair->SetTrack2(swap ? packed1.fParticle[i] : inner.fParticle[j]);
       }
 
       // check if the pair passes the cut
@@ -650,12 +813,7 @@ void AliFemtoSimpleAnalysis::MakePairs(const char* typeIn,
       // If pair passes cut, loop over CF's and add pair to real/mixed
       if (tmpPassPair) {
         for (auto &tCorrFctn : *fCorrFctnCollection) {
-          if (type == "real")
-            tCorrFctn->AddRealPair(tPair);
-          else if(type == "mixed")
-            tCorrFctn->AddMixedPair(tPair);
-          else
-            cout << "Problem with pair type, type = " << type << endl;
+          (tCorrFctn->*addPair)(tPair);
         } // loop over corellatoin functions
       }
 
@@ -675,6 +833,8 @@ void AliFemtoSimpleAnalysis::EventBegin(const AliFemtoEvent* ev)
   fSecondParticleCut->EventBegin(ev);
   fPairCut->EventBegin(ev);
 
+  fMagSign = (ev->MagneticField() < 0.0) ? -1.0 : 1.0;
+
   for (auto &cf : *fCorrFctnCollection) {
     cf->EventBegin(ev);
   }
@@ -16,6 +16,8 @@
 #include "AliFemtoV0SharedDaughterCut.h"
 #include "AliFemtoXiSharedDaughterCut.h"
 
+#include <vector>
+
 class AliFemtoPicoEventCollectionVectorHideAway;
 class AliFemtoPicoEvent;
 
@@ -54,6 +56,10 @@ class AliFemtoSimpleAnalysis : public AliFemtoAnalysis {
 
 public:
 
+  /// Kind of pairs built by MakePairs - selects whether the correlation
+  /// functions' AddRealPair or AddMixedPair method is called
+  enum PairType { kRealPair, kMixedPair };
+
   /// Construct with default parameters
   ///
   /// All pointer members are initialized to NULL except for the correlation
@@ -99,6 +105,17 @@ public:
   void SetEnablePairMonitors(Bool_t aEnable);
   Bool_t EnablePairMonitors();
 
+  /// Kinematic pair prefilter
+  ///
+  /// Pairs outside of the kT window, above the qinv limit or closer than
+  /// (deta, dphistar) at the given radius are rejected in batches before the
+  /// pair cut is called. They are treated as failing the pair cut and are
+  /// never seen by the pair cut monitors. By default the prefilter is off.
+  /// The dphistar part only applies to pairs of tracks.
+  void SetPairPrefilterKT(double ktmin, double ktmax);
+  void SetPairPrefilterQinvMax(double qinvmax);
+  void SetPairPrefilterDEtaDPhiStar(double deta, double dphistar, double radius=1.2);
+
   unsigned int NumEventsToMix() const;
   void SetNumEventsToMix(const unsigned int& NumberOfEventsToMix);
   AliFemtoPicoEvent* CurrentPicoEvent();
@@ -152,13 +169,37 @@ protected:
   /// AddMixedPair() methods. If no second particle collection is
   /// specfied, make pairs within first particle collection.
   ///
-  /// \param type Either the string "real" or "mixed", specifying which method
+  /// \param type Either kRealPair or kMixedPair, specifying which method
   ///             to call (AddRealPair or AddMixedPair)
+  void MakePairs(PairType type,
+                 AliFemtoParticleCollection* ParticlesPassingCut1,
+                 AliFemtoParticleCollection* ParticlesPssingCut2=NULL,
+                 Bool_t enablePairMonitors=kFALSE);
+
+  /// Same as above with the type given as the string "real" or "mixed"
   void MakePairs(const char* type,
                  AliFemtoParticleCollection* ParticlesPassingCut1,
                  AliFemtoParticleCollection* ParticlesPssingCut2=NULL,
                  Bool_t enablePairMonitors=kFALSE);
 
+  /// Kinematics of a particle collection copied into contiguous arrays,
+  /// used by MakePairs to run the prefilter without touching the particles
+  struct PackedParticles {
+    std::vector<AliFemtoParticle*> fParticle;
+    std::vector<double> fPx, fPy, fPz, fE, fEta, fPhi, fPt;
+    std::vector<int> fCharge;   ///< 0 for particles which are not tracks
+
+    void Fill(const AliFemtoParticleCollection &collection, bool withKinematics);
+  };
+
+  bool UsePairPrefilter() const;
+
+  /// Runs the prefilter for particle i of packed1 against particles
+  /// [jmin, jmax) of packed2 and writes the indices of surviving partners
+  /// into fPairCandidates. Returns the number of survivors.
+  size_t PrefilterPairs(const PackedParticles &packed1, size_t i,
+                        const PackedParticles &packed2, size_t jmin, size_t jmax);
+
   AliFemtoPicoEventCollectionVectorHideAway* fPicoEventCollectionVectorHideAway; //!<! Mixing Buffer used for Analyses which wrap this one
 
   AliFemtoPairCut*             fPairCut;             ///< cut applied to pairs
@@ -178,6 +219,17 @@ protected:
   Bool_t fPerformSharedDaughterCut;
   Bool_t fEnablePairMonitors;
 
+  double fPrefilterKTMin;         ///< pair prefilter: minimum kT
+  double fPrefilterKTMax;         ///< pair prefilter: maximum kT (off if <= fPrefilterKTMin)
+  double fPrefilterQinvMax;       ///< pair prefilter: maximum qinv (off if <= 0)
+  double fPrefilterDEta;          ///< pair prefilter: minimum |deta| of close track pairs (off if <= 0)
+  double fPrefilterDPhiStar;      ///< pair prefilter: minimum |dphistar| of close track pairs
+  double fPrefilterRadius;        ///< pair prefilter: radius (m) at which dphistar is evaluated
+  double fMagSign;                //!<! sign of the magnetic field of the current event
+
+  PackedParticles fPackedParticles[2];  //!<! packed particle collections for MakePairs
+  std::vector<size_t> fPairCandidates;  //!<! partners surviving the prefilter
+
 #ifdef __ROOT__
   /// \cond CLASSIMP
   ClassDef(AliFemtoSimpleAnalysis, 0);
@@ -305,4 +357,27 @@ inline void AliFemtoSimpleAnalysis::SetEnablePairMonitors(Bool_t aEnable)
   fEnablePairMonitors = aEnable;
 }
 
+inline void AliFemtoSimpleAnalysis::SetPairPrefilterKT(double ktmin, double ktmax)
+{
+  fPrefilterKTMin = ktmin;
+  fPrefilterKTMax = ktmax;
+}
+
+inline void AliFemtoSimpleAnalysis::SetPairPrefilterQinvMax(double qinvmax)
+{
+  fPrefilterQinvMax = qinvmax;
+}
+
+inline void AliFemtoSimpleAnalysis::SetPairPrefilterDEtaDPhiStar(double deta, double dphistar, double radius)
+{
+  fPrefilterDEta = deta;
+  fPrefilterDPhiStar = dphistar;
+  fPrefilterRadius = radius;
+}
+
+inline bool AliFemtoSimpleAnalysis::UsePairPrefilter() const
+{
+  return (fPrefilterKTMax > fPrefilterKTMin) || (fPrefilterQinvMax > 0.0) || (fPrefilterDEta > 0.0);
+}
+
 #endif
@@ -1,5 +1,6 @@
 #include <iostream>
 #include <math.h>
+#include <algorithm>
 #include "TChain.h"
 #include "TFile.h"
 #include "TKey.h"
@@ -171,6 +172,10 @@ AliAnalysisTaskSE(),
   fNormQPairSwitch_E1E2(),
   fNormQPairSwitch_E1E3(),
   fNormQPairSwitch_E2E3(),
+  fLowQPairStart(),
+  fLowQPairIndex(),
+  fNormQPairStart(),
+  fNormQPairIndex(),
   fMomResC2SC(0x0),
   fMomResC2MC(0x0),
   fWeightmuonCorrection(0x0),
@@ -388,6 +393,10 @@ AliFourPion::AliFourPion(const Char_t *name)
   fNormQPairSwitch_E1E2(),
   fNormQPairSwitch_E1E3(),
   fNormQPairSwitch_E2E3(),
+  fLowQPairStart(),
+  fLowQPairIndex(),
+  fNormQPairStart(),
+  fNormQPairIndex(),
   fMomResC2SC(0x0),
   fMomResC2MC(0x0),
   fWeightmuonCorrection(0x0),
@@ -610,6 +619,10 @@ AliFourPion::AliFourPion(const AliFourPion &obj)
     fNormQPairSwitch_E1E2(),
     fNormQPairSwitch_E1E3(),
     fNormQPairSwitch_E2E3(),
+    fLowQPairStart(),
+    fLowQPairIndex(),
+    fNormQPairStart(),
+    fNormQPairIndex(),
     fMomResC2SC(obj.fMomResC2SC),
     fMomResC2MC(obj.fMomResC2MC),
     fWeightmuonCorrection(obj.fWeightmuonCorrection),
@@ -2715,11 +2728,17 @@ void AliFourPion::UserExec(Option_t *)
   //////////////////////////////////////////
   // make low-q pair storage and normalization-pair storage
   // 
+  Int_t nLowQPartners[4]={0}, nNormQPartners[4]={0};
   for(Int_t en1=0; en1<=2; en1++){// 1st event number (en1=0 is the same event as current event)
     for(Int_t en2=en1; en2<=3; en2++){// 2nd event number (en2=0 is the same event as current event)
       if(en1>1 && en1==en2) continue;
+      if(en1==0) {
+	fLowQPairStart[en2].Set((fEvt)->fNtracks+1);
+	fNormQPairStart[en2].Set((fEvt)->fNtracks+1);
+      }
       
       for (Int_t i=0; i<(fEvt+en1)->fNtracks; i++) {// 1st particle
+	if(en1==0) {fLowQPairStart[en2][i]=nLowQPartners[en2]; fNormQPairStart[en2][i]=nNormQPartners[en2];}
 	for (Int_t j=i+1; j<(fEvt+en2)->fNtracks; j++) {// 2nd particle
 	  
 	  
@@ -2851,6 +2870,7 @@ void AliFourPion::UserExec(Option_t *)
 	    if(en1==1 && en2==2) {fLowQPairSwitch_E1E2[i]->AddAt('1',j);}
 	    if(en1==1 && en2==3) {fLowQPairSwitch_E1E3[i]->AddAt('1',j);}
 	    if(en1==2 && en2==3) {fLowQPairSwitch_E2E3[i]->AddAt('1',j);}
+	    if(en1==0) AddPairPartner(fLowQPairIndex[en2], nLowQPartners[en2], j);
 	  }
 	  if((qinv12 >= fNormQcutLow) && (qinv12 < fNormQcutHigh)) {
 	    if(en1==0 && en2==0) {fNormQPairSwitch_E0E0[i]->AddAt('1',j);}
@@ -2861,10 +2881,15 @@ void AliFourPion::UserExec(Option_t *)
 	    if(en1==1 && en2==2) {fNormQPairSwitch_E1E2[i]->AddAt('1',j);}
 	    if(en1==1 && en2==3) {fNormQPairSwitch_E1E3[i]->AddAt('1',j);}
 	    if(en1==2 && en2==3) {fNormQPairSwitch_E2E3[i]->AddAt('1',j);}
+	    if(en1==0) AddPairPartner(fNormQPairIndex[en2], nNormQPartners[en2], j);
 	  }
 	  
 	}
       }
+      if(en1==0) {
+	fLowQPairStart[en2][(fEvt)->fNtracks]=nLowQPartners[en2];
+	fNormQPairStart[en2][(fEvt)->fNtracks]=nNormQPartners[en2];
+      }
     }
   }
     
@@ -2904,7 +2929,8 @@ void AliFourPion::UserExec(Option_t *)
 	  pVect1[3]=(fEvt)->fTracks[i].fP[2];
 	  ch1 = Int_t(((fEvt)->fTracks[i].fCharge + 1)/2.);
 	  
-	  for (Int_t j=i+1; j<(fEvt+en2)->fNtracks; j++) {// 2nd particle
+	  for (Int_t jp=fNormQPairStart[en2][i]; jp<fNormQPairStart[en2][i+1]; jp++) {// 2nd particle
+	    Int_t j=fNormQPairIndex[en2][jp];
 	    if(en2==0) {if(fNormQPairSwitch_E0E0[i]->At(j)=='0') continue;}
 	    else {if(fNormQPairSwitch_E0E1[i]->At(j)=='0') continue;}
 	    
@@ -2913,7 +2939,8 @@ void AliFourPion::UserExec(Option_t *)
 	    pVect2[3]=(fEvt+en2)->fTracks[j].fP[2];
 	    ch2 = Int_t(((fEvt+en2)->fTracks[j].fCharge + 1)/2.);
 	   
-	    for (Int_t k=j+1; k<(fEvt+en3)->fNtracks; k++) {// 3rd particle
+	    for (Int_t kp=FirstPairPartner(fNormQPairStart[en3], fNormQPairIndex[en3], i, j); kp<fNormQPairStart[en3][i+1]; kp++) {// 3rd particle
+	      Int_t k=fNormQPairIndex[en3][kp];
 	      if(en3==0) {
 		if(fNormQPairSwitch_E0E0[i]->At(k)=='0') continue;
 		if(fNormQPairSwitch_E0E0[j]->At(k)=='0') continue;
@@ -2952,7 +2979,8 @@ void AliFourPion::UserExec(Option_t *)
 	      }
 	      
 	      
-	      for (Int_t l=k+1; l<(fEvt+en4)->fNtracks; l++) {// 4th particle
+	      for (Int_t lp=FirstPairPartner(fNormQPairStart[en4], fNormQPairIndex[en4], i, k); lp<fNormQPairStart[en4][i+1]; lp++) {// 4th particle
+		Int_t l=fNormQPairIndex[en4][lp];
 		if(en4==0){
 		  if(fNormQPairSwitch_E0E0[i]->At(l)=='0') continue;
 		  if(fNormQPairSwitch_E0E0[j]->At(l)=='0') continue;
@@ -3050,7 +3078,8 @@ void AliFourPion::UserExec(Option_t *)
 	    if((fEvt)->fTracks[i].fPt > fMaxPt) continue;
 
 	    /////////////////////////////////////////////////////////////
-	    for (Int_t j=i+1; j<(fEvt+en2)->fNtracks; j++) {// 2nd particle
+	    for (Int_t jp=fLowQPairStart[en2][i]; jp<fLowQPairStart[en2][i+1]; jp++) {// 2nd particle
+	      Int_t j=fLowQPairIndex[en2][jp];
 	      if(en2==0) {if(fLowQPairSwitch_E0E0[i]->At(j)=='0') continue;}
 	      else {if(fLowQPairSwitch_E0E1[i]->At(j)=='0') continue;}
 	      if((fEvt+en2)->fTracks[j].fPt < fMinPt) continue; 
@@ -3257,7 +3286,8 @@ void AliFourPion::UserExec(Option_t *)
 	     
 	     
 	      /////////////////////////////////////////////////////////////
-	      for (Int_t k=j+1; k<(fEvt+en3)->fNtracks; k++) {// 3rd particle
+	      for (Int_t kp=FirstPairPartner(fLowQPairStart[en3], fLowQPairIndex[en3], i, j); kp<fLowQPairStart[en3][i+1]; kp++) {// 3rd particle
+		Int_t k=fLowQPairIndex[en3][kp];
 		if(en3==0) {
 		  if(fLowQPairSwitch_E0E0[i]->At(k)=='0') continue;
 		  if(fLowQPairSwitch_E0E0[j]->At(k)=='0') continue;
@@ -3655,7 +3685,8 @@ void AliFourPion::UserExec(Option_t *)
 		
 		
 		/////////////////////////////////////////////////////////////
-		for (Int_t l=k+1; l<(fEvt+en4)->fNtracks; l++) {// 4th particle
+		for (Int_t lp=FirstPairPartner(fLowQPairStart[en4], fLowQPairIndex[en4], i, k); lp<fLowQPairStart[en4][i+1]; lp++) {// 4th particle
+		  Int_t l=fLowQPairIndex[en4][lp];
 		  if(en4==0){
 		    if(fLowQPairSwitch_E0E0[i]->At(l)=='0') continue;
 		    if(fLowQPairSwitch_E0E0[j]->At(l)=='0') continue;
@@ -4376,6 +4407,19 @@ void AliFourPion::Shuffle(Int_t *iarr, Int_t i1, Int_t i2)
 }
 
 
+//________________________________________________________________________
+void AliFourPion::AddPairPartner(TArrayI &partners, Int_t &npartners, Int_t index){
+  // append a partner to a pair list, the storage is kept between events
+  if(npartners >= partners.GetSize()) partners.Set(2*npartners + kMultLimitPbPb);
+  partners[npartners++] = index;
+}
+//________________________________________________________________________
+Int_t AliFourPion::FirstPairPartner(const TArrayI &start, const TArrayI &partners, Int_t i, Int_t index) const {
+  // position of the first partner of particle i with a larger index than "index"
+  const Int_t *first = partners.GetArray() + start[i];
+  const Int_t *last = partners.GetArray() + start[i+1];
+  return std::upper_bound(first, last, index) - partners.GetArray();
+}
 //________________________________________________________________________
 Float_t AliFourPion::GetQinv(Float_t track1[], Float_t track2[]){
   
@@ -32,6 +32,7 @@ class AliESDpid;
 #include "AliAODPid.h"
 #include "AliFourPionEventCollection.h"
 #include "AliCentrality.h"
+#include "TArrayI.h"
 
 class AliFourPion : public AliAnalysisTaskSE {
  public:
@@ -146,6 +147,8 @@ class AliFourPion : public AliAnalysisTaskSE {
   void SetFillBins3(Int_t, Int_t, Int_t, Short_t, Int_t&, Int_t&, Int_t&, Bool_t&, Bool_t&, Bool_t&);
   void SetFillBins4(Int_t, Int_t, Int_t, Int_t, Int_t&, Int_t&, Int_t&, Int_t&, Int_t, Bool_t[13]);
   void SetFSIindex(Float_t);
+  void AddPairPartner(TArrayI&, Int_t&, Int_t);
+  Int_t FirstPairPartner(const TArrayI&, const TArrayI&, Int_t, Int_t) const;
   //
   Float_t cubicInterpolate(Float_t[4], Float_t);
   Float_t nCubicInterpolate(Int_t, Float_t*, Float_t[]);
@@ -397,6 +400,13 @@ class AliFourPion : public AliAnalysisTaskSE {
   TArrayC *fNormQPairSwitch_E1E2[kMultLimitPbPb];//!
   TArrayC *fNormQPairSwitch_E1E3[kMultLimitPbPb];//!
   TArrayC *fNormQPairSwitch_E2E3[kMultLimitPbPb];//!
+  //
+  // partners of the particles of the current event (E0) in event en, in increasing order:
+  // the partners of particle i are fLowQPairIndex[en][fLowQPairStart[en][i]...fLowQPairStart[en][i+1]-1]
+  TArrayI fLowQPairStart[4];//!
+  TArrayI fLowQPairIndex[4];//!
+  TArrayI fNormQPairStart[4];//!
+  TArrayI fNormQPairIndex[4];//!
 
   TF1 *fqOutFcn; //!
   TF1 *fqSideFcn; //!
@@ -418,7 +428,7 @@ class AliFourPion : public AliAnalysisTaskSE {
   TF1 *ExchangeAmp[7][50][2];
 
  
-  ClassDef(AliFourPion, 1); 
+  ClassDef(AliFourPion, 2); 
 };
 
 #endif
@@ -756,16 +756,18 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
     className2.Form("Track_%s",fgkPairClassNames[1]);  // unlike sign, SE only
     for (Int_t i=0; i<4; ++i){
       className.Form("Track_%s",fgkTrackClassNames[i]);
-      Bool_t mergedtrkClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
-      Bool_t trkClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
+      const Int_t mergedtrkHandle=fHistos->GetClassHandle(className2.Data());
+      const Int_t trkHandle=fHistos->GetClassHandle(className.Data());
+      Bool_t mergedtrkClass=mergedtrkHandle>=0;
+      Bool_t trkClass=trkHandle>=0;
       if (!trkClass && !mergedtrkClass) continue;
       Int_t ntracks=fTracks[i].GetEntriesFast();
       for (Int_t itrack=0; itrack<ntracks; ++itrack){
         AliDielectronVarManager::Fill(fTracks[i].UncheckedAt(itrack), values);
         if(trkClass)
-          fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(trkHandle, values);
         if(mergedtrkClass && i<2)
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values); //only ev1
+          fHistos->FillClass(mergedtrkHandle, values); //only ev1
       }
     }
   }
@@ -775,8 +777,10 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
   for (Int_t i=0; i<10; ++i){
     className.Form("Pair_%s",fgkPairClassNames[i]);
     className2.Form("Track_Legs_%s",fgkPairClassNames[i]);
-    Bool_t pairClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
-    Bool_t legClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
+    const Int_t pairHandle=fHistos->GetClassHandle(className.Data());
+    const Int_t legHandle=fHistos->GetClassHandle(className2.Data());
+    Bool_t pairClass=pairHandle>=0;
+    Bool_t legClass=legHandle>=0;
     if (!pairClass&&!legClass) continue;
     Int_t ntracks=PairArray(i)->GetEntriesFast();
     for (Int_t ipair=0; ipair<ntracks; ++ipair){
@@ -785,7 +789,7 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
       //fill pair information
       if (pairClass){
         AliDielectronVarManager::Fill(pair, values);
-        fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+        fHistos->FillClass(pairHandle, values);
       }
 
       //fill leg information, don't fill the information twice
@@ -794,12 +798,12 @@ void AliDielectron::FillHistograms(const AliVEvent *ev, Bool_t pairInfoOnly)
         AliVParticle *d2=pair->GetSecondDaughterP();
         if (!arrLegs.FindObject(d1)){
           AliDielectronVarManager::Fill(d1, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legHandle, values);
           arrLegs.Add(d1);
         }
         if (!arrLegs.FindObject(d2)){
           AliDielectronVarManager::Fill(d2, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legHandle, values);
           arrLegs.Add(d2);
         }
       }
@@ -833,23 +837,23 @@ void AliDielectron::FillHistogramsPair(AliDielectronPair *pair,Bool_t fromPreFil
     className2.Form("Track_Legs_%s",fgkPairClassNames[type]);
   }
 
-  Bool_t pairClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
-  Bool_t legClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
+  const Int_t pairHandle=fHistos->GetClassHandle(className.Data());
+  const Int_t legHandle=fHistos->GetClassHandle(className2.Data());
 
   //fill pair information
-  if (pairClass){
+  if (pairHandle>=0){
     AliDielectronVarManager::Fill(pair, values);
-    fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+    fHistos->FillClass(pairHandle, values);
   }
 
-  if (legClass){
+  if (legHandle>=0){
     AliVParticle *d1=pair->GetFirstDaughterP();
     AliDielectronVarManager::Fill(d1, values);
-    fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+    fHistos->FillClass(legHandle, values);
 
     AliVParticle *d2=pair->GetSecondDaughterP();
     AliDielectronVarManager::Fill(d2, values);
-    fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+    fHistos->FillClass(legHandle, values);
   }
 }
 
@@ -1624,9 +1628,12 @@ void AliDielectron::FillMCHistograms(const AliVEvent *ev) {
     className.Form("Pair_%s",fSignalsMC->At(isig)->GetName());
     className2.Form("Track_Legs_%s",fSignalsMC->At(isig)->GetName());
     className3.Form("Track_%s_%s",fgkPairClassNames[1],fSignalsMC->At(isig)->GetName());  // unlike sign, SE only
-    Bool_t pairClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
-    Bool_t legClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
-    Bool_t mergedtrkClass=fHistos->GetHistogramList()->FindObject(className3.Data())!=0x0;
+    const Int_t pairHandle=fHistos->GetClassHandle(className.Data());
+    const Int_t legHandle=fHistos->GetClassHandle(className2.Data());
+    Bool_t pairClass=pairHandle>=0;
+    Bool_t legClass=legHandle>=0;
+    const Int_t mergedtrkHandle=fHistos->GetClassHandle(className3.Data());
+    Bool_t mergedtrkClass=mergedtrkHandle>=0;
     if(!pairClass && !legClass && !mergedtrkClass) continue;
 
     // fill pair and/or their leg variables
@@ -1640,14 +1647,14 @@ void AliDielectron::FillMCHistograms(const AliVEvent *ev) {
             //fill pair information
             if (pairClass){
               AliDielectronVarManager::Fill(pair, values);
-              fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+              fHistos->FillClass(pairHandle, values);
             }
             //fill leg information, both + and - in the same histo
             if (legClass){
               AliDielectronVarManager::Fill(pair->GetFirstDaughterP(),values);
-              fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+              fHistos->FillClass(legHandle, values);
               AliDielectronVarManager::Fill(pair->GetSecondDaughterP(),values);
-              fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+              fHistos->FillClass(legHandle, values);
             }
           } //is signal
         } //loop: pairs
@@ -1661,14 +1668,14 @@ void AliDielectron::FillMCHistograms(const AliVEvent *ev) {
             //fill pair information
             if (pairClass){
               AliDielectronVarManager::Fill(pair, values);
-              fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+              fHistos->FillClass(pairHandle, values);
             }
             //fill leg information, both + and - in the same histo
             if (legClass){
               AliDielectronVarManager::Fill(pair->GetFirstDaughterP(),values);
-              fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+              fHistos->FillClass(legHandle, values);
               AliDielectronVarManager::Fill(pair->GetSecondDaughterP(),values);
-              fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+              fHistos->FillClass(legHandle, values);
             }
           } //is signal
         } //loop: pairs
@@ -1682,14 +1689,14 @@ void AliDielectron::FillMCHistograms(const AliVEvent *ev) {
             //fill pair information
             if (pairClass){
               AliDielectronVarManager::Fill(pair, values);
-              fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+              fHistos->FillClass(pairHandle, values);
             }
             //fill leg information, both + and - in the same histo
             if (legClass){
               AliDielectronVarManager::Fill(pair->GetFirstDaughterP(),values);
-              fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+              fHistos->FillClass(legHandle, values);
               AliDielectronVarManager::Fill(pair->GetSecondDaughterP(),values);
-              fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+              fHistos->FillClass(legHandle, values);
             }
           } //is signal
         } //loop: pairs
@@ -1708,7 +1715,7 @@ void AliDielectron::FillMCHistograms(const AliVEvent *ev) {
         // skip if track does not correspond to the signal
         if(!isMCtruth1 && !isMCtruth2) continue;
         AliDielectronVarManager::Fill(fTracks[i].UncheckedAt(itrack), values);
-        fHistos->FillClass(className3, AliDielectronVarManager::kNMaxValues, values);
+        fHistos->FillClass(mergedtrkHandle, values);
       } //loop: tracks
     } //loop: arrays
 
@@ -2160,8 +2167,10 @@ void AliDielectron::FillHistogramsFromPairArray(Bool_t pairInfoOnly/*=kFALSE*/)
 
     className.Form("Pair_%s",fgkPairClassNames[i]);
     className2.Form("Track_Legs_%s",fgkPairClassNames[i]);
-    Bool_t pairClass=fHistos->GetHistogramList()->FindObject(className.Data())!=0x0;
-    Bool_t legClass=fHistos->GetHistogramList()->FindObject(className2.Data())!=0x0;
+    const Int_t pairHandle=fHistos->GetClassHandle(className.Data());
+    const Int_t legHandle=fHistos->GetClassHandle(className2.Data());
+    Bool_t pairClass=pairHandle>=0;
+    Bool_t legClass=legHandle>=0;
 
     //    if (!pairClass&&!legClass) continue;
     for (Int_t ipair=0; ipair<npairs; ++ipair){
@@ -2191,7 +2200,7 @@ void AliDielectron::FillHistogramsFromPairArray(Bool_t pairInfoOnly/*=kFALSE*/)
       //fill pair information
       if (pairClass){
         AliDielectronVarManager::Fill(pair, values);
-        fHistos->FillClass(className, AliDielectronVarManager::kNMaxValues, values);
+        fHistos->FillClass(pairHandle, values);
       }
 
       //fill leg information, don't fill the information twice
@@ -2200,12 +2209,12 @@ void AliDielectron::FillHistogramsFromPairArray(Bool_t pairInfoOnly/*=kFALSE*/)
         AliVParticle *d2=pair->GetSecondDaughterP();
         if (!arrLegs.FindObject(d1)){
           AliDielectronVarManager::Fill(d1, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legHandle, values);
           arrLegs.Add(d1);
         }
         if (!arrLegs.FindObject(d2)){
           AliDielectronVarManager::Fill(d2, values);
-          fHistos->FillClass(className2, AliDielectronVarManager::kNMaxValues, values);
+          fHistos->FillClass(legHandle, values);
           arrLegs.Add(d2);
         }
       }
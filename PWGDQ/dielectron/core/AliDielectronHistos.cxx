@@ -61,7 +61,13 @@ AliDielectronHistos::AliDielectronHistos() :
   fHistoList(),
   fList(0x0),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
-  fReservedWords(new TString)
+  fReservedWords(new TString),
+  fNFillPlans(0),
+  fFillPlanStart(0x0),
+  fFillPlan(0x0),
+  fFillPlanVars(0x0),
+  fFillPlanBuffer(0x0),
+  fFillPlansValid(kFALSE)
 {
   //
   // Default constructor
@@ -77,7 +83,13 @@ AliDielectronHistos::AliDielectronHistos(const char* name, const char* title) :
   fHistoList(),
   fList(0x0),
   fUsedVars(new TBits(AliDielectronVarManager::kNMaxValues)),
-  fReservedWords(new TString)
+  fReservedWords(new TString),
+  fNFillPlans(0),
+  fFillPlanStart(0x0),
+  fFillPlan(0x0),
+  fFillPlanVars(0x0),
+  fFillPlanBuffer(0x0),
+  fFillPlansValid(kFALSE)
 {
   //
   // TNamed constructor
@@ -96,6 +108,7 @@ AliDielectronHistos::~AliDielectronHistos()
   if (fUsedVars) delete fUsedVars;
   if (fList) fList->Clear();
   delete fReservedWords;
+  ClearFillPlans();
 }
 
 //_____________________________________________________________________________
@@ -625,6 +638,7 @@ void AliDielectronHistos::UserHistogram(const char* histClass, TObject* hist, UI
   }
 
   classTable->Add(hist);
+  fFillPlansValid=kFALSE;
 }
 
 //_____________________________________________________________________________
@@ -653,6 +667,7 @@ void AliDielectronHistos::AddClass(const char* histClass)
     fHistoList.Add(table);
   }
   delete arr;
+  fFillPlansValid=kFALSE;
 }
 
 //_____________________________________________________________________________
@@ -720,6 +735,172 @@ void AliDielectronHistos::FillClass(const char* histClass, Int_t nValues, const
   return;
 }
 
+//_____________________________________________________________________________
+void AliDielectronHistos::InitFillPlans()
+{
+  //
+  // Resolve for each histogram class the histograms, their type and the
+  // variable indices, such that FillClass(handle,...) needs neither name
+  // lookups nor type checks. Histograms which FillValues would fill via the
+  // trigger map special cases are kept as generic entries.
+  //
+  ClearFillPlans();
+
+  Int_t nClasses=fHistoList.GetEntries();
+  Int_t nEntries=0;
+  Int_t nVars=0;
+  Int_t maxDim=0;
+  TIter nextClass(&fHistoList);
+  THashList *classTable=0x0;
+  while ( (classTable=(THashList*)nextClass()) ){
+    TIter nextHist(classTable);
+    TObject *obj=0x0;
+    while ( (obj=nextHist()) ){
+      ++nEntries;
+      if (obj->InheritsFrom(THnBase::Class())){
+        Int_t dim=static_cast<THnBase*>(obj)->GetNdimensions();
+        nVars+=dim+1;
+        if (dim>maxDim) maxDim=dim;
+      } else {
+        nVars+=4;
+      }
+    }
+  }
+
+  fNFillPlans=nClasses;
+  fFillPlanStart=new Int_t[nClasses+1];
+  fFillPlan=new FillPlanEntry[nEntries>0?nEntries:1];
+  fFillPlanVars=new UInt_t[nVars>0?nVars:1];
+  fFillPlanBuffer=new Double_t[maxDim>0?maxDim:1];
+
+  Int_t ientry=0;
+  Int_t ivar=0;
+  Int_t iclass=0;
+  nextClass.Reset();
+  while ( (classTable=(THashList*)nextClass()) ){
+    fFillPlanStart[iclass++]=ientry;
+    TIter nextHist(classTable);
+    TObject *obj=0x0;
+    while ( (obj=nextHist()) ){
+      UInt_t valueTypes=obj->GetUniqueID();
+      if (valueTypes==(UInt_t)AliDielectronHistos::kNoAutoFill) continue;
+      Bool_t weight = (valueTypes!=kNoWeights);
+      FillPlanEntry &e=fFillPlan[ientry];
+      e.fHist=obj;
+      e.fVarOffset=ivar;
+      UInt_t *vars=fFillPlanVars+ivar;
+
+      if (obj->InheritsFrom(TH1::Class())){
+        TH1 *h=static_cast<TH1*>(obj);
+        vars[0]=h->GetXaxis()->GetUniqueID();
+        vars[1]=h->GetYaxis()->GetUniqueID();
+        vars[2]=h->GetZaxis()->GetUniqueID();
+        vars[3]=valueTypes;
+        e.fNVars=4;
+
+        Bool_t trigger=kFALSE;
+        for (Int_t i=0; i<4; ++i)
+          if (vars[i]==AliDielectronVarManager::kTriggerInclONL || vars[i]==AliDielectronVarManager::kTriggerInclOFF) trigger=kTRUE;
+
+        Bool_t bprf=(h->IsA()==TProfile::Class() || h->IsA()==TProfile2D::Class() || h->IsA()==TProfile3D::Class());
+        if (h->IsA()==TProfile3D::Class()) weight=kFALSE;
+
+        if (trigger) e.fKind=kPlanGeneric;
+        else {
+          switch (h->GetDimension()){
+          case 1:  e.fKind = bprf ? (weight ? kPlanProf1W : kPlanProf1) : (weight ? kPlanH1W : kPlanH1); break;
+          case 2:  e.fKind = bprf ? (weight ? kPlanProf2W : kPlanProf2) : (weight ? kPlanH2W : kPlanH2); break;
+          case 3:  e.fKind = bprf ? kPlanProf3 : (weight ? kPlanH3W : kPlanH3); break;
+          default: continue;
+          }
+        }
+      } else if (obj->InheritsFrom(THnBase::Class())){
+        THnBase *hn=static_cast<THnBase*>(obj);
+        Int_t dim=hn->GetNdimensions();
+        for (Int_t it=0; it<dim; ++it) vars[it]=hn->GetAxis(it)->GetUniqueID();
+        vars[dim]=valueTypes;
+        e.fNVars=dim;
+        e.fKind = weight ? kPlanHnW : kPlanHn;
+      } else {
+        continue;
+      }
+
+      ivar+=(e.fKind==kPlanHn||e.fKind==kPlanHnW) ? e.fNVars+1 : 4;
+      ++ientry;
+    }
+  }
+  fFillPlanStart[nClasses]=ientry;
+  fFillPlansValid=kTRUE;
+}
+
+//_____________________________________________________________________________
+void AliDielectronHistos::ClearFillPlans()
+{
+  //
+  // delete the fill plans
+  //
+  delete [] fFillPlanStart;
+  delete [] fFillPlan;
+  delete [] fFillPlanVars;
+  delete [] fFillPlanBuffer;
+  fFillPlanStart=0x0;
+  fFillPlan=0x0;
+  fFillPlanVars=0x0;
+  fFillPlanBuffer=0x0;
+  fNFillPlans=0;
+  fFillPlansValid=kFALSE;
+}
+
+//_____________________________________________________________________________
+Int_t AliDielectronHistos::GetClassHandle(const char* histClass)
+{
+  //
+  // return the handle of class 'histClass' for FillClass(handle,values)
+  // -1 if the class does not exist
+  //
+  TObject *classTable=fHistoList.FindObject(histClass);
+  if (!classTable) return -1;
+  if (!fFillPlansValid) InitFillPlans();
+  return fHistoList.IndexOf(classTable);
+}
+
+//_____________________________________________________________________________
+void AliDielectronHistos::FillClass(Int_t handle, const Double_t *values)
+{
+  //
+  // Fill class by handle obtained from GetClassHandle
+  //
+  if (!fFillPlansValid) InitFillPlans();
+  if (handle<0 || handle>=fNFillPlans) return;
+
+  const Int_t last=fFillPlanStart[handle+1];
+  for (Int_t ientry=fFillPlanStart[handle]; ientry<last; ++ientry){
+    const FillPlanEntry &e=fFillPlan[ientry];
+    const UInt_t *v=fFillPlanVars+e.fVarOffset;
+    switch (e.fKind){
+    case kPlanH1:     static_cast<TH1*>(e.fHist)->Fill(values[v[0]]); break;
+    case kPlanH1W:    static_cast<TH1*>(e.fHist)->Fill(values[v[0]], values[v[3]]); break;
+    case kPlanProf1:  static_cast<TProfile*>(e.fHist)->Fill(values[v[0]], values[v[1]]); break;
+    case kPlanProf1W: static_cast<TProfile*>(e.fHist)->Fill(values[v[0]], values[v[1]], values[v[3]]); break;
+    case kPlanH2:     static_cast<TH1*>(e.fHist)->Fill(values[v[0]], values[v[1]]); break;
+    case kPlanH2W:    static_cast<TH2*>(e.fHist)->Fill(values[v[0]], values[v[1]], values[v[3]]); break;
+    case kPlanProf2:  static_cast<TProfile2D*>(e.fHist)->Fill(values[v[0]], values[v[1]], values[v[2]]); break;
+    case kPlanProf2W: static_cast<TProfile2D*>(e.fHist)->Fill(values[v[0]], values[v[1]], values[v[2]], values[v[3]]); break;
+    case kPlanH3:     static_cast<TH3*>(e.fHist)->Fill(values[v[0]], values[v[1]], values[v[2]]); break;
+    case kPlanH3W:    static_cast<TH3*>(e.fHist)->Fill(values[v[0]], values[v[1]], values[v[2]], values[v[3]]); break;
+    case kPlanProf3:  static_cast<TProfile3D*>(e.fHist)->Fill(values[v[0]], values[v[1]], values[v[2]], values[v[3]]); break;
+    case kPlanHn:
+    case kPlanHnW:
+      for (Int_t it=0; it<e.fNVars; ++it) fFillPlanBuffer[it]=values[v[it]];
+      if (e.fKind==kPlanHn) static_cast<THnBase*>(e.fHist)->Fill(fFillPlanBuffer);
+      else                  static_cast<THnBase*>(e.fHist)->Fill(fFillPlanBuffer, values[v[e.fNVars]]);
+      break;
+    default:
+      FillValues(e.fHist, values);
+    }
+  }
+}
+
 //_____________________________________________________________________________
 // void AliDielectronHistos::FillClass(const char* histClass, const TVectorD &vals)
 // {
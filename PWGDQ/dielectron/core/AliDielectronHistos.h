@@ -145,6 +145,11 @@ public:
   
 //   void FillClass(const char* histClass, const TVectorD &vals);
   void FillClass(const char* histClass, Int_t nValues, const Double_t *values);
+
+  // pre-resolved filling: resolve the class name once, fill by handle
+  void  InitFillPlans();
+  Int_t GetClassHandle(const char* histClass);
+  void  FillClass(Int_t handle, const Double_t *values);
   
   TObject* GetHist(const char* histClass, const char* name) const;
   TH1* GetHistogram(const char* histClass, const char* name) const;
@@ -152,7 +157,7 @@ public:
   TH1* GetHistogram(const char* cutClass, const char* histClass, const char* name) const;
 
   void SetHistogramList(THashList &list, Bool_t setOwner=kTRUE);
-  void ResetHistogramList(){fHistoList.Clear();}
+  void ResetHistogramList(){fHistoList.Clear(); fFillPlansValid=kFALSE;}
   const THashList* GetHistogramList() const {return &fHistoList;}
 
   void SetList(TList * const list) { fList=list; }
@@ -189,13 +194,34 @@ public:
 
 private:
 
+  // fill information of one histogram, resolved by InitFillPlans
+  enum EFillPlanKind { kPlanGeneric=0,
+                       kPlanH1, kPlanH1W, kPlanProf1, kPlanProf1W,
+                       kPlanH2, kPlanH2W, kPlanProf2, kPlanProf2W,
+                       kPlanH3, kPlanH3W, kPlanProf3,
+                       kPlanHn, kPlanHnW };
+  struct FillPlanEntry {
+    TObject *fHist;       // histogram to fill
+    Int_t    fKind;       // EFillPlanKind
+    Int_t    fNVars;      // number of axis variables
+    Int_t    fVarOffset;  // first variable in fFillPlanVars
+  };
+
   void FillVarArray(TObject *obj, UInt_t *valType);
+  void ClearFillPlans();
 
   THashList fHistoList;             //-> list of histograms
   TList    *fList;                  //! List of list of histograms
 	TBits     *fUsedVars;            // list of used variables
 
   TString *fReservedWords;          //! list of reserved words
+
+  Int_t          fNFillPlans;       //! number of classes with a fill plan
+  Int_t         *fFillPlanStart;    //! first plan entry per class (fNFillPlans+1)
+  FillPlanEntry *fFillPlan;         //! plan entries of all classes
+  UInt_t        *fFillPlanVars;     //! variable indices of all plan entries
+  Double_t      *fFillPlanBuffer;   //! fill array for THn entries
+  Bool_t         fFillPlansValid;   //! plans correspond to fHistoList
   void UserHistogramReservedWords(const char* histClass, const TObject *hist, UInt_t valTypes);
   void FillClass(THashTable *classTable, Int_t nValues, Double_t *values);
   
@@ -208,7 +234,7 @@ private:
   AliDielectronHistos(const AliDielectronHistos &hist);
   AliDielectronHistos& operator = (const AliDielectronHistos &hist);
 
-  ClassDef(AliDielectronHistos,3)
+  ClassDef(AliDielectronHistos,4)
 };
 
 #endif
@@ -238,10 +238,10 @@ void AliDielectronMixingHandler::DoMixing(TClonesArray &pool, AliDielectron *die
   TObjArray arrTrDummy[4];
   for (Int_t i=0; i<4; ++i) arrTrDummy[i]=diele->fTracks[i];
 
-  //buffer also global event data
-  Double_t values[AliDielectronVarManager::kNMaxValues]={0};
-  for (Int_t i=AliDielectronVarManager::kPairMax; i<AliDielectronVarManager::kNMaxValues; ++i)
-    values[i]=AliDielectronVarManager::GetValue((AliDielectronVarManager::ValueTypes)i);
+  //keep the value context of the current event; the mixing only fills pair
+  //values, so the event data need not be buffered
+  AliDielectronVarManager::ValueContext *ctx=AliDielectronVarManager::GetContext();
+  const Double_t *values=ctx->fData;
 
 
   // The event data should alread be filled, since
@@ -353,8 +353,9 @@ void AliDielectronMixingHandler::DoMixing(TClonesArray &pool, AliDielectron *die
     diele->fTracks[i]=arrTrDummy[i];
   }
 
-  //set back global event values
-  AliDielectronVarManager::SetEventData(values);
+  //set back the event context and clear the particle values
+  AliDielectronVarManager::SetContext(ctx);
+  for (Int_t i=0; i<AliDielectronVarManager::kPairMax; ++i) ctx->fData[i]=0.;
 }
 
 //______________________________________________
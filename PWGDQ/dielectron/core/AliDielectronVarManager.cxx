@@ -653,14 +653,10 @@ const char* AliDielectronVarManager::fgkParticleNames[AliDielectronVarManager::k
 };
 
 AliPIDResponse* AliDielectronVarManager::fgPIDResponse      = 0x0;
-AliVEvent*      AliDielectronVarManager::fgEvent            = 0x0;
-AliEventplane*  AliDielectronVarManager::fgTPCEventPlane    = 0x0;
-AliKFVertex*    AliDielectronVarManager::fgKFVertex         = 0x0;
 TProfile*       AliDielectronVarManager::fgMultEstimatorAvg[7][9] = {{0x0}};
 TH3D*           AliDielectronVarManager::fgTRDpidEff[10][4] = {{0x0}};
 TObject*        AliDielectronVarManager::fgLegEffMap           = 0x0;
 TObject*        AliDielectronVarManager::fgPairEffMap          = 0x0;
-TBits*          AliDielectronVarManager::fgFillMap          = 0x0;
 Double_t        AliDielectronVarManager::fgTRDpidEffCentRanges[10][4] = {{0.0}};
 TString         AliDielectronVarManager::fgVZEROCalibrationFile = "";
 TString         AliDielectronVarManager::fgVZERORecenteringFile = "";
@@ -672,7 +668,8 @@ AliDielectronQnEPcorrection* AliDielectronVarManager::fgQnEPacRemoval = 0x0;
 Bool_t          AliDielectronVarManager::fgEventPlaneACremoval = kFALSE;
 TString         AliDielectronVarManager::fgQnVectorNorm = "";
 Int_t           AliDielectronVarManager::fgCurrentRun = -1;
-Double_t        AliDielectronVarManager::fgData[AliDielectronVarManager::kNMaxValues] = {0.};
+AliDielectronVarManager::ValueContext  AliDielectronVarManager::fgDefaultContext;
+AliDielectronVarManager::ValueContext* AliDielectronVarManager::fgContext = &AliDielectronVarManager::fgDefaultContext;
 //________________________________________________________________
 AliDielectronVarManager::AliDielectronVarManager() :
   TNamed("AliDielectronVarManager","AliDielectronVarManager")
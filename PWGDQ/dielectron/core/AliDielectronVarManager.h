@@ -686,6 +686,29 @@ public:
     // TODO: (for A+A) ZDCEnergy, impact parameter, Iflag??
   };
 
+  // Per-event state used by the Fill functions: value array, fill map and
+  // event pointers. The manager works on the context selected with
+  // SetContext(); by default this is a single process-wide instance.
+  class ValueContext {
+  public:
+    ValueContext() : fEvent(0x0), fTPCEventPlane(0x0), fKFVertex(0x0), fFillMap(0x0)
+      { for (Int_t i=0; i<kNMaxValues; ++i) fData[i]=0.; }
+    ~ValueContext() { delete fKFVertex; }
+
+    Double_t        fData[kNMaxValues];   // values of the current event
+    AliVEvent      *fEvent;               // current event pointer
+    AliEventplane  *fTPCEventPlane;       // current event tpc plane pointer
+    AliKFVertex    *fKFVertex;            // kf vertex (owned)
+    TBits          *fFillMap;             // map for requested variable filling
+
+  private:
+    ValueContext(const ValueContext &c);
+    ValueContext &operator=(const ValueContext &c);
+  };
+
+  static ValueContext* GetContext() { return fgContext; }
+  static ValueContext* SetContext(ValueContext *ctx);
+
 
   AliDielectronVarManager();
   AliDielectronVarManager(const char* name, const char* title);
@@ -701,7 +724,7 @@ public:
   static void InitTRDpidEffHistograms(const Char_t* filename);
   static void SetLegEffMap( TObject *map) { fgLegEffMap=map; }
   static void SetPairEffMap(TObject *map) { fgPairEffMap=map; }
-  static void SetFillMap(   TBits   *map) { fgFillMap=map; }
+  static void SetFillMap(   TBits   *map) { fgContext->fFillMap=map; }
   static void SetVZEROCalibrationFile(const Char_t* filename) {fgVZEROCalibrationFile = filename;}
 
   static void SetVZERORecenteringFile(const Char_t* filename) {fgVZERORecenteringFile = filename;}
@@ -722,24 +745,24 @@ public:
   static Double_t GetSingleLegEff(Double_t * const values);
   static Double_t GetPairEff(Double_t * const values);
 
-  static const AliKFVertex* GetKFVertex() {return fgKFVertex;}
+  static const AliKFVertex* GetKFVertex() {return fgContext->fKFVertex;}
 
   static const char* GetValueName(Int_t i) { return (i>=0&&i<kNMaxValues)?fgkParticleNames[i][0]:""; }
   static const char* GetValueLabel(Int_t i) { return (i>=0&&i<kNMaxValues)?fgkParticleNames[i][1]:""; }
   static const char* GetValueUnit(Int_t i) { return (i>=0&&i<kNMaxValues)?fgkParticleNames[i][2]:""; }
   static UInt_t GetValueType(const char* valname);
-  static const Double_t* GetData() {return fgData;}
-  static AliVEvent* GetCurrentEvent() {return fgEvent;}
+  static const Double_t* GetData() {return fgContext->fData;}
+  static AliVEvent* GetCurrentEvent() {return fgContext->fEvent;}
 
-  static Double_t GetValue(ValueTypes var) {return fgData[var];}
-  static void SetValue(ValueTypes var, Double_t val) { fgData[var]=val; }
+  static Double_t GetValue(ValueTypes var) {return fgContext->fData[var];}
+  static void SetValue(ValueTypes var, Double_t val) { fgContext->fData[var]=val; }
 
 
 private:
 
   static const char* fgkParticleNames[kNMaxValues][3];  //variable names
 
-  static Bool_t Req(ValueTypes var) { return (fgFillMap ? fgFillMap->TestBitNumber(var) : kTRUE); }
+  static Bool_t Req(ValueTypes var) { TBits *map=fgContext->fFillMap; return (map ? map->TestBitNumber(var) : kTRUE); }
   static void FillVarESDtrack(const AliESDtrack *particle,           Double_t * const values);
   static void FillVarAODTrack(const AliAODTrack *particle,           Double_t * const values);
   static void FillVarVTrdTrack(const AliVParticle *particle,         Double_t * const values);
@@ -760,15 +783,11 @@ private:
   static void InitZDCRecenteringHistograms(Int_t runNo);
 
   static AliPIDResponse  *fgPIDResponse;        // PID response object
-  static AliVEvent       *fgEvent;              // current event pointer
-  static AliEventplane   *fgTPCEventPlane;      // current event tpc plane pointer
-  static AliKFVertex     *fgKFVertex;           // kf vertex
   static TProfile        *fgMultEstimatorAvg[7][9];  // multiplicity estimator averages (7 periods x 18 estimators)
   static Double_t         fgTRDpidEffCentRanges[10][4];   // centrality ranges for the TRD pid efficiency histograms
   static TH3D            *fgTRDpidEff[10][4];   // TRD pid efficiencies from conversion electrons
   static TObject         *fgLegEffMap;             // single electron efficiencies
   static TObject         *fgPairEffMap;             // pair efficiencies
-  static TBits           *fgFillMap;             // map for requested variable filling
   static TString          fgVZEROCalibrationFile;  // file with VZERO channel-by-channel calibrations
   static TString          fgVZERORecenteringFile;  // file with VZERO Q-vector averages needed for event plane recentering
   static TProfile2D      *fgVZEROCalib[64];           // 1 histogram per VZERO channel
@@ -786,7 +805,8 @@ private:
   static Double_t CalculateEPDiff(Double_t detArp, Double_t detBrp);
 
 
-  static Double_t fgData[kNMaxValues];        //! data
+  static ValueContext     fgDefaultContext;     //! context used when none is selected
+  static ValueContext    *fgContext;            //! currently selected context
 
   AliDielectronVarManager(const AliDielectronVarManager &c);
   AliDielectronVarManager &operator=(const AliDielectronVarManager &c);
@@ -865,9 +885,9 @@ inline void AliDielectronVarManager::FillVarVParticle(const AliVParticle *partic
     }
   }
 
-//   if ( fgEvent ) AliDielectronVarManager::Fill(fgEvent, values);
+//   if ( fgContext->fEvent ) AliDielectronVarManager::Fill(fgContext->fEvent, values);
   for (Int_t i=AliDielectronVarManager::kPairMax; i<AliDielectronVarManager::kNMaxValues; ++i)
-    values[i]=fgData[i];
+    values[i]=fgContext->fData[i];
 }
 
 inline void AliDielectronVarManager::FillVarESDtrack(const AliESDtrack *particle, Double_t * const values)
@@ -1048,15 +1068,15 @@ inline void AliDielectronVarManager::FillVarESDtrack(const AliESDtrack *particle
   const AliExternalTrackParam *out=particle->GetOuterParam();
   if(out) values[AliDielectronVarManager::kPOut] = out->GetP();
   else values[AliDielectronVarManager::kPOut] = mom;
-  if(out && fgEvent) {
+  if(out && fgContext->fEvent) {
     Double_t localCoord[3]={0.0};
-    Bool_t localCoordGood = out->GetXYZAt(298.0, ((AliESDEvent*)fgEvent)->GetMagneticField(), localCoord);
+    Bool_t localCoordGood = out->GetXYZAt(298.0, ((AliESDEvent*)fgContext->fEvent)->GetMagneticField(), localCoord);
     values[AliDielectronVarManager::kTRDphi] = (localCoordGood && TMath::Abs(localCoord[0])>1.0e-6 && TMath::Abs(localCoord[1])>1.0e-6 ? TMath::ATan2(localCoord[1], localCoord[0]) : -999.);
   }
   if(mc->HasMC() && fgTRDpidEff[0][0]) {
-    Int_t runNo = (fgEvent ? fgEvent->GetRunNumber() : -1);
+    Int_t runNo = (fgContext->fEvent ? fgContext->fEvent->GetRunNumber() : -1);
     Float_t centrality=-1.0;
-    AliCentrality *esdCentrality = (fgEvent ? fgEvent->GetCentrality() : 0x0);
+    AliCentrality *esdCentrality = (fgContext->fEvent ? fgContext->fEvent->GetCentrality() : 0x0);
     if(esdCentrality) centrality = esdCentrality->GetCentralityPercentile("V0M");
     Double_t effErr=0.0;
     values[kTRDpidEffLeg] = GetTRDpidEfficiency(runNo, centrality, values[AliDielectronVarManager::kEta],
@@ -1141,19 +1161,19 @@ inline void AliDielectronVarManager::FillVarESDtrack(const AliESDtrack *particle
   if(Req(kTRDonlineA)||Req(kTRDonlineLayerMask)||Req(kTRDonlinePID)||Req(kTRDonlinePt)||Req(kTRDonlineStack)||Req(kTRDonlineTrackInTime)||Req(kTRDonlineSector)||Req(kTRDonlineFlagsTiming)||Req(kTRDonlineLabel)||Req(kTRDonlineNTracklets)||Req(kTRDonlineFirstLayer))
     FillVarVTrdTrack(particle,values);
 
-  if( fgEvent && fgEvent->GetMagneticField() ){
+  if( fgContext->fEvent && fgContext->fEvent->GetMagneticField() ){
     if(out){
       AliExternalTrackParam out_tmp(*out);
-      out_tmp.PropagateTo(AliTRDgeometry::GetXtrdBeg(), fgEvent->GetMagneticField());
+      out_tmp.PropagateTo(AliTRDgeometry::GetXtrdBeg(), fgContext->fEvent->GetMagneticField());
       values[AliDielectronVarManager::kTRDeta] = out_tmp.Eta();
     }
     else{
       AliESDtrack particle_tmp(*particle);
-      particle_tmp.PropagateTo(AliTRDgeometry::GetXtrdBeg(), fgEvent->GetMagneticField());
+      particle_tmp.PropagateTo(AliTRDgeometry::GetXtrdBeg(), fgContext->fEvent->GetMagneticField());
       values[AliDielectronVarManager::kTRDeta] = particle_tmp.Eta();
     }
     int mode = particle->GetInnerParam() ? 1:0;
-    values[kTPCActiveLength] = particle->GetLengthInActiveZone(mode, 2., 220., fgEvent->GetMagneticField());
+    values[kTPCActiveLength] = particle->GetLengthInActiveZone(mode, 2., 220., fgContext->fEvent->GetMagneticField());
     values[kTPCGeomLength] = values[kTPCActiveLength] / ( 130 - TMath::Power( TMath::Abs( particle->GetSigned1Pt() ),1.5 ) );
     values[AliDielectronVarManager::kInTRDacceptance] = TMath::Abs( values[AliDielectronVarManager::kTRDeta] )<0.85 && (  (values[AliDielectronVarManager::kCharge]<0&&(  values[AliDielectronVarManager::kPhi]<1.32 || (values[AliDielectronVarManager::kPhi]>1.98 && values[AliDielectronVarManager::kPhi]<4.10)||  ( values[AliDielectronVarManager::kPhi]>5.12  && values[AliDielectronVarManager::kPhi]<5.48  && TMath::Abs( values[AliDielectronVarManager::kTRDeta] )>0.155 )  || values[AliDielectronVarManager::kPhi]>5.48 )) ||   (values[AliDielectronVarManager::kCharge]>0&&(  values[AliDielectronVarManager::kPhi]<1.52 || (values[AliDielectronVarManager::kPhi]>2.20 && values[AliDielectronVarManager::kPhi]<4.32)||  ( values[AliDielectronVarManager::kPhi]>5.32  && values[AliDielectronVarManager::kPhi]<5.68  && TMath::Abs( values[AliDielectronVarManager::kTRDeta]  )>0.155 )  || values[AliDielectronVarManager::kPhi]>5.68 )) )  ? 1: 0;
   }
@@ -1335,7 +1355,7 @@ inline void AliDielectronVarManager::FillVarAODTrack(const AliAODTrack *particle
       Double_t l  = TMath::C()* expt[0]*1e-12;    // m
       Double_t t  = pid->GetTOFsignal();          // ps start time subtracted (until v5-02-Rev09)
       AliTOFHeader* tofH=0x0;                     // from v5-02-Rev10 on subtract the start time
-      if(fgEvent) tofH = (AliTOFHeader*)fgEvent->GetTOFHeader();
+      if(fgContext->fEvent) tofH = (AliTOFHeader*)fgContext->fEvent->GetTOFHeader();
       if(tofH) t -= fgPIDResponse->GetTOFResponse().GetStartTime(particle->P()); // ps
 
     if( (l < 360.e-2 || l > 800.e-2) || (t <= 0.) ) {
@@ -1713,7 +1733,7 @@ inline void AliDielectronVarManager::FillVarMCParticle2(const AliVParticle *p1,
   //values[AliDielectronVarManager::kMMC] = values[AliDielectronVarManager::kM];
   //values[AliDielectronVarManager::kPtMC] = values[AliDielectronVarManager::kPt];
 
-  if ( fgEvent ) AliDielectronVarManager::Fill(fgEvent, values);
+  if ( fgContext->fEvent ) AliDielectronVarManager::Fill(fgContext->fEvent, values);
 
   values[AliDielectronVarManager::kThetaHE]   = AliDielectronPair::ThetaPhiCM(p1,p2,kTRUE,  kTRUE);
   values[AliDielectronVarManager::kPhiHE]     = AliDielectronPair::ThetaPhiCM(p1,p2,kTRUE,  kFALSE);
@@ -1787,7 +1807,7 @@ inline void AliDielectronVarManager::FillVarAODMCParticle(const AliAODMCParticle
   values[AliDielectronVarManager::kNumberOfDaughters]=mc->NumberOfDaughters(particle);
 
   // using AODMCHEader information
-  AliAODMCHeader *mcHeader = (AliAODMCHeader*)fgEvent->FindListObject(AliAODMCHeader::StdBranchName());
+  AliAODMCHeader *mcHeader = (AliAODMCHeader*)fgContext->fEvent->FindListObject(AliAODMCHeader::StdBranchName());
   if(mcHeader) {
     values[AliDielectronVarManager::kImpactParZ]  = mcHeader->GetVtxZ()-particle->Zv();
     values[AliDielectronVarManager::kImpactParXY] = TMath::Sqrt(TMath::Power(mcHeader->GetVtxX()-particle->Xv(),2) +
@@ -1853,7 +1873,7 @@ inline void AliDielectronVarManager::FillVarDielectronPair(const AliDielectronPa
   if(Req(kOpeningAngle))     values[AliDielectronVarManager::kOpeningAngle]     = pair->OpeningAngle();
   if(Req(kOpeningAngleXY))     values[AliDielectronVarManager::kOpeningAngleXY] = pair->OpeningAngleXY();
   if(Req(kOpeningAngleRZ))     values[AliDielectronVarManager::kOpeningAngleRZ] = pair->OpeningAngleRZ();
-  if(Req(kCosPointingAngle)) values[AliDielectronVarManager::kCosPointingAngle] = fgEvent ? pair->GetCosPointingAngle(fgEvent->GetPrimaryVertex()) : -1;
+  if(Req(kCosPointingAngle)) values[AliDielectronVarManager::kCosPointingAngle] = fgContext->fEvent ? pair->GetCosPointingAngle(fgContext->fEvent->GetPrimaryVertex()) : -1;
 
   if(Req(kLegDist))   values[AliDielectronVarManager::kLegDist]      = pair->DistanceDaughters();
   if(Req(kLegDistXY)) values[AliDielectronVarManager::kLegDistXY]    = pair->DistanceDaughtersXY();
@@ -1866,8 +1886,8 @@ inline void AliDielectronVarManager::FillVarDielectronPair(const AliDielectronPa
   if(Req(kArmAlpha)) values[AliDielectronVarManager::kArmAlpha]     = pair->GetArmAlpha();
   if(Req(kArmPt))    values[AliDielectronVarManager::kArmPt]        = pair->GetArmPt();
 
-  if(Req(kPsiPair))  values[AliDielectronVarManager::kPsiPair]      = fgEvent ? pair->PsiPair(fgEvent->GetMagneticField()) : -5;
-  if(Req(kPhivPair)) values[AliDielectronVarManager::kPhivPair]     = fgEvent ? pair->PhivPair(fgEvent->GetMagneticField()) : -5;
+  if(Req(kPsiPair))  values[AliDielectronVarManager::kPsiPair]      = fgContext->fEvent ? pair->PsiPair(fgContext->fEvent->GetMagneticField()) : -5;
+  if(Req(kPhivPair)) values[AliDielectronVarManager::kPhivPair]     = fgContext->fEvent ? pair->PhivPair(fgContext->fEvent->GetMagneticField()) : -5;
 
   values[AliDielectronVarManager::kITSscPair]   = -999;
   if(Req(kITSscPair)) { 
@@ -1913,17 +1933,17 @@ inline void AliDielectronVarManager::FillVarDielectronPair(const AliDielectronPa
   }
 
   if(Req(kDeltaCotTheta)) values[kDeltaCotTheta] =  pair->DeltaCotTheta();
-  if(Req(kTriangularConversionCut)) values[AliDielectronVarManager::kTriangularConversionCut] = fgEvent ? pair->PhivPair(fgEvent->GetMagneticField()) - 21. * pair->M() : -999.;
+  if(Req(kTriangularConversionCut)) values[AliDielectronVarManager::kTriangularConversionCut] = fgContext->fEvent ? pair->PhivPair(fgContext->fEvent->GetMagneticField()) - 21. * pair->M() : -999.;
   if(Req(kPseudoProperTime) || Req(kPseudoProperTimeErr)) {
     values[AliDielectronVarManager::kPseudoProperTime] =
-      fgEvent ? kfPair.GetPseudoProperDecayTime(*(fgEvent->GetPrimaryVertex()), TDatabasePDG::Instance()->GetParticle(443)->Mass(), &errPseudoProperTime2 ) : -1e10;
-  // values[AliDielectronVarManager::kPseudoProperTime] = fgEvent ? pair->GetPseudoProperTime(fgEvent->GetPrimaryVertex()): -1e10;
+      fgContext->fEvent ? kfPair.GetPseudoProperDecayTime(*(fgContext->fEvent->GetPrimaryVertex()), TDatabasePDG::Instance()->GetParticle(443)->Mass(), &errPseudoProperTime2 ) : -1e10;
+  // values[AliDielectronVarManager::kPseudoProperTime] = fgContext->fEvent ? pair->GetPseudoProperTime(fgContext->fEvent->GetPrimaryVertex()): -1e10;
     values[AliDielectronVarManager::kPseudoProperTimeErr] = (errPseudoProperTime2 > 0) ? TMath::Sqrt(errPseudoProperTime2) : -1e10;
   }
 
   // impact parameter
   Double_t d0z0[2]={-999., -999.};
-  if( (Req(kImpactParXY) || Req(kImpactParZ)) && fgEvent) pair->GetDCA(fgEvent->GetPrimaryVertex(), d0z0);
+  if( (Req(kImpactParXY) || Req(kImpactParZ)) && fgContext->fEvent) pair->GetDCA(fgContext->fEvent->GetPrimaryVertex(), d0z0);
   values[AliDielectronVarManager::kImpactParXY]   = d0z0[0];
   values[AliDielectronVarManager::kImpactParZ]    = d0z0[1];
 
@@ -2092,7 +2112,7 @@ inline void AliDielectronVarManager::FillVarDielectronPair(const AliDielectronPa
 	values[AliDielectronVarManager::kDeltaEta]     = TMath::Abs(feta1 -feta2 );
 	values[AliDielectronVarManager::kDeltaPhi]     = lv1.DeltaPhi(lv2);
 
-       if( Req(kDeltaPhiChargeOrdered) && fgEvent ) values[AliDielectronVarManager::kDeltaPhiChargeOrdered] = fD1.GetQ() * fgEvent->GetMagneticField() > 0 ? lv1.Phi() - lv2.Phi() :lv2.Phi() - lv1.Phi() ;
+       if( Req(kDeltaPhiChargeOrdered) && fgContext->fEvent ) values[AliDielectronVarManager::kDeltaPhiChargeOrdered] = fD1.GetQ() * fgContext->fEvent->GetMagneticField() > 0 ? lv1.Phi() - lv2.Phi() :lv2.Phi() - lv1.Phi() ;
 	values[AliDielectronVarManager::kPairType]     = pair->GetType();
 
         // Calculate pair variables for corresponding generated pair
@@ -2169,15 +2189,15 @@ inline void AliDielectronVarManager::FillVarDielectronPair(const AliDielectronPa
   if(Req(kSinPhiH2)) values[AliDielectronVarManager::kSinPhiH2] = TMath::Sin(2*phi);
   Double_t delta=0.0;
   // v2 with respect to VZERO-A event plane
-  delta = TVector2::Phi_mpi_pi(phi - fgData[AliDielectronVarManager::kV0ArpH2]);
+  delta = TVector2::Phi_mpi_pi(phi - fgContext->fData[AliDielectronVarManager::kV0ArpH2]);
   if(Req(kV0ArpH2FlowV2))   values[AliDielectronVarManager::kV0ArpH2FlowV2] = TMath::Cos(2.0*delta);  // 2nd harmonic flow coefficient
   if(Req(kDeltaPhiV0ArpH2)) values[AliDielectronVarManager::kDeltaPhiV0ArpH2] = delta;
   // v2 with respect to VZERO-C event plane
-  delta = TVector2::Phi_mpi_pi(phi - fgData[AliDielectronVarManager::kV0CrpH2]);
+  delta = TVector2::Phi_mpi_pi(phi - fgContext->fData[AliDielectronVarManager::kV0CrpH2]);
   if(Req(kV0CrpH2FlowV2))   values[AliDielectronVarManager::kV0CrpH2FlowV2] = TMath::Cos(2.0*delta);  // 2nd harmonic flow coefficient
   if(Req(kDeltaPhiV0CrpH2)) values[AliDielectronVarManager::kDeltaPhiV0CrpH2] = delta;
   // v2 with respect to the combined VZERO-A and VZERO-C event plane
-  delta = TVector2::Phi_mpi_pi(phi - fgData[AliDielectronVarManager::kV0ACrpH2]);
+  delta = TVector2::Phi_mpi_pi(phi - fgContext->fData[AliDielectronVarManager::kV0ACrpH2]);
   if(Req(kV0ACrpH2FlowV2))   values[AliDielectronVarManager::kV0ACrpH2FlowV2] = TMath::Cos(2.0*delta);  // 2nd harmonic flow coefficient
   if(Req(kDeltaPhiV0ACrpH2)) values[AliDielectronVarManager::kDeltaPhiV0ACrpH2] = delta;
 
@@ -2264,15 +2284,15 @@ inline void AliDielectronVarManager::FillVarDielectronPair(const AliDielectronPa
     // fill kPseudoProperTimeResolution
     values[AliDielectronVarManager::kPseudoProperTimeResolution] = -1e10;
     // values[AliDielectronVarManager::kPseudoProperTimePull] = -1e10;
-    if(samemother && fgEvent) {
+    if(samemother && fgContext->fEvent) {
       if(pair->GetFirstDaughterP()->GetLabel() > 0) {
         const AliVParticle *motherMC = 0x0;
         Int_t motherLbl = 0;
-        if(fgEvent->IsA() == AliESDEvent::Class()){
+        if(fgContext->fEvent->IsA() == AliESDEvent::Class()){
           motherMC = (AliMCParticle*) mc->GetMCTrackMother((AliESDtrack*) pair->GetFirstDaughterP());
           motherLbl = motherMC->GetLabel();
         }
-        else if(fgEvent->IsA() == AliAODEvent::Class()){
+        else if(fgContext->fEvent->IsA() == AliAODEvent::Class()){
           motherMC = (AliAODMCParticle*) mc->GetMCTrackMother((AliAODTrack*) pair->GetFirstDaughterP());
           AliAODMCParticle *daughterMC = (AliAODMCParticle*) mc->GetMCTrack(pair->GetFirstDaughterP());
           motherLbl = daughterMC->GetMother();
@@ -2403,9 +2423,9 @@ inline void AliDielectronVarManager::FillVarKFParticle(const AliKFParticle *part
   values[AliDielectronVarManager::kHasCocktailMother]=0;
   values[AliDielectronVarManager::kHasCocktailGrandMother]=0;
 
-//   if ( fgEvent ) AliDielectronVarManager::Fill(fgEvent, values);
+//   if ( fgContext->fEvent ) AliDielectronVarManager::Fill(fgContext->fEvent, values);
   for (Int_t i=AliDielectronVarManager::kPairMax; i<AliDielectronVarManager::kNMaxValues; ++i)
-    values[i]=fgData[i];
+    values[i]=fgContext->fData[i];
 
 }
 
@@ -3411,21 +3431,34 @@ inline Double_t AliDielectronVarManager::GetTRDpidEfficiency(Int_t runNo, Double
 }
 
 
+inline AliDielectronVarManager::ValueContext* AliDielectronVarManager::SetContext(ValueContext *ctx)
+{
+  //
+  // select the context used by the Fill functions, returns the previous one
+  // passing 0x0 selects the default context
+  //
+  ValueContext *prev=fgContext;
+  fgContext = (ctx ? ctx : &fgDefaultContext);
+  return prev;
+}
+
 inline void AliDielectronVarManager::SetEvent(AliVEvent * const ev)
 {
-  fgEvent = ev;
-  if (fgKFVertex) delete fgKFVertex;
-  fgKFVertex=0x0;
+  ValueContext *ctx=fgContext;
+  ctx->fEvent = ev;
+  if (ctx->fKFVertex) delete ctx->fKFVertex;
+  ctx->fKFVertex=0x0;
   if (!ev) return;
-  if (ev->GetPrimaryVertex()) fgKFVertex=new AliKFVertex(*ev->GetPrimaryVertex());
-  for (Int_t i=0; i<AliDielectronVarManager::kNMaxValues;++i) fgData[i]=0.;
-  AliDielectronVarManager::Fill(fgEvent, fgData);
+  if (ev->GetPrimaryVertex()) ctx->fKFVertex=new AliKFVertex(*ev->GetPrimaryVertex());
+  for (Int_t i=0; i<AliDielectronVarManager::kNMaxValues;++i) ctx->fData[i]=0.;
+  AliDielectronVarManager::Fill(ctx->fEvent, ctx->fData);
 }
 
 inline void AliDielectronVarManager::SetEventData(const Double_t data[AliDielectronVarManager::kNMaxValues])
 {
-  for (Int_t i=0; i<kNMaxValues;++i) fgData[i]=0.;
-  for (Int_t i=kPairMax; i<kNMaxValues;++i) fgData[i]=data[i];
+  Double_t *values=fgContext->fData;
+  for (Int_t i=0; i<kNMaxValues;++i) values[i]=0.;
+  for (Int_t i=kPairMax; i<kNMaxValues;++i) values[i]=data[i];
 }
 
 
@@ -3440,7 +3473,7 @@ inline Bool_t AliDielectronVarManager::GetDCA(const AliAODTrack *track, Double_t
   }
 
   Bool_t ok=kFALSE;
-  if(fgEvent) {
+  if(fgContext->fEvent) {
     AliExternalTrackParam etp; etp.CopyFromVTrack(track);
 
     Float_t xstart = etp.GetX();
@@ -3450,8 +3483,8 @@ inline Bool_t AliDielectronVarManager::GetDCA(const AliAODTrack *track, Double_t
       return kFALSE;
     }
 
-    AliAODVertex *vtx =(AliAODVertex*)(fgEvent->GetPrimaryVertex());
-    Double_t fBzkG = fgEvent->GetMagneticField(); // z componenent of field in kG
+    AliAODVertex *vtx =(AliAODVertex*)(fgContext->fEvent->GetPrimaryVertex());
+    Double_t fBzkG = fgContext->fEvent->GetMagneticField(); // z componenent of field in kG
     ok = etp.PropagateToDCA(vtx,fBzkG,kVeryBig,d0z0,covd0z0);
   }
   if(!ok){
@@ -3464,10 +3497,10 @@ inline Bool_t AliDielectronVarManager::GetDCA(const AliAODTrack *track, Double_t
 inline void AliDielectronVarManager::SetTPCEventPlane(AliEventplane *const evplane)
 {
 
-  fgTPCEventPlane = evplane;
-  FillVarTPCEventPlane(evplane,fgData);
-  //  for (Int_t i=0; i<AliDielectronVarManager::kNMaxValues;++i) fgData[i]=0.;
-  //  AliDielectronVarManager::Fill(fgEvent, fgData);
+  fgContext->fTPCEventPlane = evplane;
+  FillVarTPCEventPlane(evplane,fgContext->fData);
+  //  for (Int_t i=0; i<AliDielectronVarManager::kNMaxValues;++i) fgContext->fData[i]=0.;
+  //  AliDielectronVarManager::Fill(fgContext->fEvent, fgContext->fData);
 }
 
 
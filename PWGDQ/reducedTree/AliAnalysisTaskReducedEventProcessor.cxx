@@ -17,6 +17,7 @@ Instructions in AddTask_EPcorrectionsExample.C
 #include <TTimeStamp.h>
 #include <TStopwatch.h>
 #include <TChain.h>
+#include <TObjArray.h>
 #include <THashList.h>
 #include <AliInputEventHandler.h>
 #include <AliMultiInputEventHandler.h>
@@ -42,6 +43,7 @@ ClassImp(AliAnalysisTaskReducedEventProcessor);
 AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor() :
   AliAnalysisTaskSE(),
   fReducedTask(0x0),
+  fReducedTasks(0x0),
   fRunningMode(kUseEventsFromTree),
   fReducedEvent(),
   fWriteFilteredTree(kFALSE)
@@ -55,6 +57,7 @@ AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor() :
 AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor(const char* name, Int_t runningMode, Bool_t writeFilteredTree) :
   AliAnalysisTaskSE(name),
   fReducedTask(0x0),
+  fReducedTasks(0x0),
   fRunningMode(runningMode),
   fReducedEvent(),
   fWriteFilteredTree(writeFilteredTree)
@@ -73,6 +76,62 @@ AliAnalysisTaskReducedEventProcessor::AliAnalysisTaskReducedEventProcessor(const
 }
 
 
+//_________________________________________________________________________________
+AliAnalysisTaskReducedEventProcessor::~AliAnalysisTaskReducedEventProcessor()
+{
+  //
+  // Destructor (the reduced tasks are not owned)
+  //
+  if(fReducedTasks) delete fReducedTasks;
+}
+
+
+//_________________________________________________________________________________
+void AliAnalysisTaskReducedEventProcessor::AddTask(AliReducedAnalysisTaskSE* task)
+{
+  //
+  // Add an analysis task. All the tasks process the same reduced events, one after the other.
+  // The first task uses the output slots 1 (histograms) and 2 (filtered tree, if enabled), the
+  // slots of the next tasks are given by GetHistogramOutputSlot(i) and GetFilteredTreeOutputSlot(i)
+  //
+  if(!task) return;
+  if(!fReducedTasks) fReducedTasks = new TObjArray();
+  fReducedTasks->Add(task);
+  if(!fReducedTask) {
+     fReducedTask = task;        // outputs already defined in the constructor
+     return;
+  }
+  
+  Int_t i = fReducedTasks->GetEntriesFast()-1;
+  DefineOutput(GetHistogramOutputSlot(i), THashList::Class());
+  if(fWriteFilteredTree)
+     DefineOutput(GetFilteredTreeOutputSlot(i), TTree::Class());
+}
+
+
+//_________________________________________________________________________________
+Int_t AliAnalysisTaskReducedEventProcessor::GetNReducedTasks() const
+{
+  //
+  // Number of analysis tasks
+  //
+  if(!fReducedTasks) return (fReducedTask ? 1 : 0);
+  return fReducedTasks->GetEntriesFast();
+}
+
+
+//_________________________________________________________________________________
+AliReducedAnalysisTaskSE* AliAnalysisTaskReducedEventProcessor::GetReducedTask(Int_t i) const
+{
+  //
+  // Get the i-th analysis task
+  //
+  if(!fReducedTasks) return (i==0 ? fReducedTask : 0x0);
+  if(i<0 || i>=fReducedTasks->GetEntriesFast()) return 0x0;
+  return (AliReducedAnalysisTaskSE*)fReducedTasks->UncheckedAt(i);
+}
+
+
 //______________________________________________________________________________
 void AliAnalysisTaskReducedEventProcessor::ConnectInputData(Option_t* /*option*/)
 {
@@ -105,14 +164,17 @@ void AliAnalysisTaskReducedEventProcessor::UserCreateOutputObjects()
   //
   // Add all histogram manager histogram lists to the output TList
   //
-  fReducedTask->GetHistogramManager()->AddHistogramsToOutputList();
-  PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
+  for(Int_t i=0; i<GetNReducedTasks(); i++) {
+     AliReducedAnalysisTaskSE* task = GetReducedTask(i);
+     task->GetHistogramManager()->AddHistogramsToOutputList();
+     PostData(GetHistogramOutputSlot(i), task->GetHistogramManager()->GetHistogramOutputList());
   
-  if(fWriteFilteredTree) {
-     OpenFile(2);
-     fReducedTask->InitFilteredTree();
-     PostData(2, fReducedTask->GetFilteredTree());
-  }  
+     if(fWriteFilteredTree) {
+        OpenFile(GetFilteredTreeOutputSlot(i));
+        task->InitFilteredTree();
+        PostData(GetFilteredTreeOutputSlot(i), task->GetFilteredTree());
+     }
+  }
   
   return;
 }
@@ -139,13 +201,17 @@ void AliAnalysisTaskReducedEventProcessor::UserExec(Option_t *){
   }
   
   if(!event) return;
-    
-  fReducedTask->SetEvent(event);
-  fReducedTask->Process();
-  PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
   
-  if(fWriteFilteredTree)  {
-     PostData(2, fReducedTask->GetFilteredTree());
+  // the event is read once and processed by all the tasks
+  for(Int_t i=0; i<GetNReducedTasks(); i++) {
+     AliReducedAnalysisTaskSE* task = GetReducedTask(i);
+     task->SetEvent(event);
+     task->Process();
+     PostData(GetHistogramOutputSlot(i), task->GetHistogramManager()->GetHistogramOutputList());
+  
+     if(fWriteFilteredTree)  {
+        PostData(GetFilteredTreeOutputSlot(i), task->GetFilteredTree());
+     }
   }
 } 
 
@@ -156,10 +222,13 @@ void AliAnalysisTaskReducedEventProcessor::FinishTaskOutput()
     //
     // Finish Task 
     //
-  fReducedTask->Finish();
-  PostData(1, fReducedTask->GetHistogramManager()->GetHistogramOutputList());
-  if(fWriteFilteredTree)
-     PostData(2, fReducedTask->GetFilteredTree());
+  for(Int_t i=0; i<GetNReducedTasks(); i++) {
+     AliReducedAnalysisTaskSE* task = GetReducedTask(i);
+     task->Finish();
+     PostData(GetHistogramOutputSlot(i), task->GetHistogramManager()->GetHistogramOutputList());
+     if(fWriteFilteredTree)
+        PostData(GetFilteredTreeOutputSlot(i), task->GetFilteredTree());
+  }
   
   return;
 }
@@ -15,6 +15,7 @@
 #include "AliReducedBaseEvent.h"
 
 class TObject;
+class TObjArray;
 class AliAnalysis;
 class AliReducedAnalysisTaskSE;
 
@@ -30,9 +31,9 @@ public:
  public:
   AliAnalysisTaskReducedEventProcessor();
   AliAnalysisTaskReducedEventProcessor(const char *name, Int_t runningMode=kUseEventsFromTree, Bool_t writeFilteredTree=kFALSE);
-  virtual ~AliAnalysisTaskReducedEventProcessor(){}
+  virtual ~AliAnalysisTaskReducedEventProcessor();
 
-  void AddTask(AliReducedAnalysisTaskSE* task) {fReducedTask=task;}
+  void AddTask(AliReducedAnalysisTaskSE* task);
 
   virtual void UserExec(Option_t *);
   virtual void UserCreateOutputObjects();
@@ -42,11 +43,17 @@ public:
 
   Int_t GetRunningMode() const {return fRunningMode;}  
   AliReducedAnalysisTaskSE* GetReducedTask() const {return fReducedTask;}
+  AliReducedAnalysisTaskSE* GetReducedTask(Int_t i) const;
+  Int_t GetNReducedTasks() const;
+  // output slots of the i-th task: histogram list, and the filtered tree in the next slot (if enabled)
+  Int_t GetHistogramOutputSlot(Int_t i) const {return 1+i*(fWriteFilteredTree ? 2 : 1);}
+  Int_t GetFilteredTreeOutputSlot(Int_t i) const {return GetHistogramOutputSlot(i)+1;}
   
   Bool_t GetWriteFilteredTree() const {return fWriteFilteredTree;}
   
  protected:
-  AliReducedAnalysisTaskSE* fReducedTask;      // Pointer to the analysis task which will process the reduced events
+  AliReducedAnalysisTaskSE* fReducedTask;      // Pointer to the (first) analysis task which will process the reduced events
+  TObjArray* fReducedTasks;                         // All the analysis tasks processing the same reduced events (not owned)
   
   Int_t fRunningMode;                               // Running mode, as specified in options 1 and 2 from Constants
   
@@ -57,7 +64,7 @@ public:
   AliAnalysisTaskReducedEventProcessor(const AliAnalysisTaskReducedEventProcessor &c);
   AliAnalysisTaskReducedEventProcessor& operator= (const AliAnalysisTaskReducedEventProcessor &c);
 
-  ClassDef(AliAnalysisTaskReducedEventProcessor, 4);
+  ClassDef(AliAnalysisTaskReducedEventProcessor, 5);
 };
 
 #endif
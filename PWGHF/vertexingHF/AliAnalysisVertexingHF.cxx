@@ -152,6 +152,8 @@ fOKInvMassLctoV0(kFALSE),
 fnTrksTotal(0),
 fnSeleTrksTotal(0),
 fMakeReducedRHF(kFALSE),
+fUsePairPreFilter(kFALSE),
+fPairPreFilterScale(3.),
 fMassDzero(0.),
 fMassDplus(0.),
 fMassDs(0.),
@@ -247,6 +249,8 @@ fOKInvMassLctoV0(source.fOKInvMassLctoV0),
 fnTrksTotal(0),
 fnSeleTrksTotal(0),
 fMakeReducedRHF(kFALSE),
+fUsePairPreFilter(source.fUsePairPreFilter),
+fPairPreFilterScale(source.fPairPreFilterScale),
 fMassDzero(source.fMassDzero),
 fMassDplus(source.fMassDplus),
 fMassDs(source.fMassDs),
@@ -344,6 +348,8 @@ AliAnalysisVertexingHF &AliAnalysisVertexingHF::operator=(const AliAnalysisVerte
   fMassLambdaC = source.fMassLambdaC;
   fMassDstar = source.fMassDstar;
   fMassJpsi = source.fMassJpsi;
+  fUsePairPreFilter = source.fUsePairPreFilter;
+  fPairPreFilterScale = source.fPairPreFilterScale;
 
   return *this;
 }
@@ -618,6 +624,14 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   AliDebug(1,Form(" Selected tracks: %d",nSeleTrks));
   fnSeleTrksTotal += nSeleTrks;
 
+  // straight lines at the primary vertex for the pair pre-filter
+  Double_t *trkLines = 0x0;
+  Double_t preFilterDist = fPairPreFilterScale*dcaMax;
+  if(fUsePairPreFilter && nSeleTrks>0) {
+    trkLines = new Double_t[6*nSeleTrks];
+    FillTrackLinesAtVertex(tracksAtVertex,nSeleTrks,trkLines);
+  }
+
 
   TObjArray *twoTrackArray1    = new TObjArray(2);
   TObjArray *twoTrackArray2    = new TObjArray(2);
@@ -859,6 +873,8 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 
       }
 
+      if(trkLines && !PairPreFilter(&trkLines[6*iTrkP1],&trkLines[6*iTrkN1],preFilterDist)) { negtrack1=0; continue; }
+
       // back to primary vertex
       //      postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
       //      negtrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1121,6 +1137,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	  if(!TESTBIT(seleFlags[iTrkP1],kBitKaonCompat) &&
 	     !TESTBIT(seleFlags[iTrkP2],kBitKaonCompat) ) okForDsToKKpi=kFALSE;
 	}
+	if(trkLines && (!PairPreFilter(&trkLines[6*iTrkP2],&trkLines[6*iTrkN1],preFilterDist) ||
+			!PairPreFilter(&trkLines[6*iTrkP2],&trkLines[6*iTrkP1],preFilterDist))) { postrack2=0; continue; }
+
 	// back to primary vertex
 	//	postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
 	//	postrack2->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1400,6 +1419,9 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
 	     !TESTBIT(seleFlags[iTrkN2],kBitKaonCompat) ) okForDsToKKpi=kFALSE;
 	}
 
+	if(trkLines && (!PairPreFilter(&trkLines[6*iTrkP1],&trkLines[6*iTrkN2],preFilterDist) ||
+			!PairPreFilter(&trkLines[6*iTrkN1],&trkLines[6*iTrkN2],preFilterDist))) { negtrack2=0; continue; }
+
 	// back to primary vertex
 	// postrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
 	// negtrack1->PropagateToDCA(fV1,fBzkG,kVeryBig);
@@ -1546,6 +1568,7 @@ void AliAnalysisVertexingHF::FindCandidates(AliVEvent *event,
   fourTrackArray->Delete();  delete fourTrackArray;
   delete [] seleFlags; seleFlags=NULL;
   if(evtNumber) {delete [] evtNumber; evtNumber=NULL;}
+  if(trkLines) {delete [] trkLines; trkLines=NULL;}
   tracksAtVertex.Delete();
 
   if(fInputAOD) {
@@ -2897,6 +2920,7 @@ void AliAnalysisVertexingHF::PrintStatus() const {
   }
   if(fRecoPrimVtxSkippingTrks) printf("RecoPrimVtxSkippingTrks\n");
   if(fRmTrksFromPrimVtx) printf("RmTrksFromPrimVtx\n");
+  if(fUsePairPreFilter) printf("Pair pre-filter on straight-line distance < %.1f x dca cut\n",fPairPreFilterScale);
   if(fD0toKpi) {
     printf("Reconstruct D0->Kpi candidates with cuts:\n");
     if(fCutsD0toKpi) fCutsD0toKpi->PrintAll();
@@ -3697,6 +3721,47 @@ void AliAnalysisVertexingHF::SetParametersAtVertex(AliESDtrack* esdt, const AliE
   return;
 }
 //-----------------------------------------------------------------------------
+void AliAnalysisVertexingHF::FillTrackLinesAtVertex(const TObjArray &tracksAtVertex,
+						    Int_t nSeleTrks, Double_t *lines) const{
+  /// Store for each selected track the point of closest approach to the
+  /// primary vertex and the unit momentum direction there (6 values per track)
+
+  for(Int_t i=0; i<nSeleTrks; i++){
+    const AliExternalTrackParam *par=(const AliExternalTrackParam*)tracksAtVertex.UncheckedAt(i);
+    Double_t *l=&lines[6*i];
+    Double_t p[3];
+    par->GetXYZ(l);
+    par->GetPxPyPz(p);
+    Double_t norm=TMath::Sqrt(p[0]*p[0]+p[1]*p[1]+p[2]*p[2]);
+    if(norm<1.e-9) norm=1.;
+    l[3]=p[0]/norm; l[4]=p[1]/norm; l[5]=p[2]/norm;
+  }
+  return;
+}
+//-----------------------------------------------------------------------------
+Bool_t AliAnalysisVertexingHF::PairPreFilter(const Double_t *line1, const Double_t *line2,
+					     Double_t maxDist) const{
+  /// Coarse pair selection: distance of closest approach of the two tracks
+  /// approximated by straight lines at the primary vertex. Only meant to
+  /// reject pairs far outside the dca cut before the helix GetDCA.
+
+  Double_t d[3]={line2[0]-line1[0],line2[1]-line1[1],line2[2]-line1[2]};
+  Double_t n[3]={line1[4]*line2[5]-line1[5]*line2[4],
+		 line1[5]*line2[3]-line1[3]*line2[5],
+		 line1[3]*line2[4]-line1[4]*line2[3]};
+  Double_t n2=n[0]*n[0]+n[1]*n[1]+n[2]*n[2];
+  Double_t maxDist2=maxDist*maxDist;
+  if(n2<1.e-12){
+    // (anti)parallel lines: distance of point 2 from line 1
+    Double_t c[3]={d[1]*line1[5]-d[2]*line1[4],
+		   d[2]*line1[3]-d[0]*line1[5],
+		   d[0]*line1[4]-d[1]*line1[3]};
+    return (c[0]*c[0]+c[1]*c[1]+c[2]*c[2])<=maxDist2;
+  }
+  Double_t dn=d[0]*n[0]+d[1]*n[1]+d[2]*n[2];
+  return dn*dn<=maxDist2*n2;
+}
+//-----------------------------------------------------------------------------
 void AliAnalysisVertexingHF::SetMasses(){
   /// Set the hadron mass values from TDatabasePDG
 
@@ -94,6 +94,7 @@ class AliAnalysisVertexingHF : public TNamed {
   void SetMixEventOff() { fMixEvent=kFALSE; }
   void SetInputAOD() { fInputAOD=kTRUE; }
   void SetMakeReducedRHF(Bool_t makeredAOD=kFALSE) { fMakeReducedRHF=makeredAOD; }
+  void SetPairPreFilter(Bool_t use=kTRUE, Double_t scale=3.) { fUsePairPreFilter=use; fPairPreFilterScale=scale; }
   Bool_t GetD0toKpi() const { return fD0toKpi; }
   Bool_t GetJPSItoEle() const { return fJPSItoEle; }
   Bool_t Get3Prong() const { return f3Prong; }
@@ -107,6 +108,8 @@ class AliAnalysisVertexingHF : public TNamed {
   Bool_t GetRecoPrimVtxSkippingTrks() const {return fRecoPrimVtxSkippingTrks;}
   Bool_t GetRmTrksFromPrimVtx() const {return fRmTrksFromPrimVtx;}
   Bool_t GetMakeReducedRHF() const {return fMakeReducedRHF;}
+  Bool_t GetUsePairPreFilter() const {return fUsePairPreFilter;}
+  Double_t GetPairPreFilterScale() const {return fPairPreFilterScale;}
   void SetFindVertexForDstar(Bool_t vtx=kTRUE) { fFindVertexForDstar=vtx; }
   void SetFindVertexForCascades(Bool_t vtx=kTRUE) { fFindVertexForCascades=vtx; }
 
@@ -340,6 +343,8 @@ class AliAnalysisVertexingHF : public TNamed {
   Int_t  fnTrksTotal;
   Int_t  fnSeleTrksTotal;
   Bool_t fMakeReducedRHF;// switch the reduction of dAOD size on/off
+  Bool_t fUsePairPreFilter; /// reject track pairs by straight-line distance before GetDCA
+  Double_t fPairPreFilterScale; /// pre-filter distance in units of the dca cut
 
   Double_t fMassDzero;
   Double_t fMassDplus;
@@ -411,6 +416,8 @@ class AliAnalysisVertexingHF : public TNamed {
 				   Int_t &nSeleTrks,
 				   UChar_t *seleFlags,Int_t *evtNumber);
   void SetParametersAtVertex(AliESDtrack* esdt, const AliExternalTrackParam* extpar) const;
+  void FillTrackLinesAtVertex(const TObjArray &tracksAtVertex, Int_t nSeleTrks, Double_t *lines) const;
+  Bool_t PairPreFilter(const Double_t *line1, const Double_t *line2, Double_t maxDist) const;
 
   Bool_t SingleTrkCuts(AliESDtrack *trk,Float_t centralityperc, Bool_t &okDisplaced,Bool_t &okSoftPi, Bool_t &ok3prong, Bool_t &okBachelor) const;
 
@@ -420,7 +427,7 @@ class AliAnalysisVertexingHF : public TNamed {
 				  TObjArray *twoTrackArrayV0);
 
   /// \cond CLASSIMP
-  ClassDef(AliAnalysisVertexingHF,27);  // Reconstruction of HF decay candidates
+  ClassDef(AliAnalysisVertexingHF,28);  // Reconstruction of HF decay candidates
   /// \endcond
 };
 
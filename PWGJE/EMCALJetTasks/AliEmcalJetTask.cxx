@@ -79,6 +79,7 @@ AliEmcalJetTask::AliEmcalJetTask() :
   fIsEmcPart(0),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fReuseFJDefinitions(kFALSE),
   fJets(0),
   fFastJetWrapper("AliEmcalJetTask","AliEmcalJetTask"),
   fClusterContainerIndexMap(),
@@ -115,6 +116,7 @@ AliEmcalJetTask::AliEmcalJetTask(const char *name) :
   fIsEmcPart(0),
   fLegacyMode(kFALSE),
   fFillGhost(kFALSE),
+  fReuseFJDefinitions(kFALSE),
   fJets(0),
   fFastJetWrapper(name,name),
   fClusterContainerIndexMap(),
@@ -410,6 +412,7 @@ void AliEmcalJetTask::ExecOnce()
   fFastJetWrapper.SetAlgorithm(ConvertToFJAlgo(fJetAlgo));
   fFastJetWrapper.SetRecombScheme(ConvertToFJRecoScheme(fRecombScheme));
   fFastJetWrapper.SetMaxRap(1);
+  fFastJetWrapper.SetReuseDefinitions(fReuseFJDefinitions);
  
 
   // setting legacy mode
@@ -117,24 +117,26 @@ class AliFJWrapper
   
   void SetName(const char* name)        { fName           = name;    }
   void SetTitle(const char* title)      { fTitle          = title;   }
-  void SetStrategy(const fastjet::Strategy &strat)                 { fStrategy = strat;  }
-  void SetAlgorithm(const fastjet::JetAlgorithm &algor)            { fAlgor    = algor;  }
-  void SetRecombScheme(const fastjet::RecombinationScheme &scheme) { fScheme   = scheme; }
-  void SetAreaType(const fastjet::AreaType &atype)                 { fAreaType = atype;  }
-  void SetNRepeats(Int_t nrepeat)       { fNGhostRepeats  = nrepeat; }
-  void SetGhostArea(Double_t gharea)    { fGhostArea      = gharea;  }
-  void SetMaxRap(Double_t maxrap)       { fMaxRap         = maxrap;  }
-  void SetR(Double_t r)                 { fR              = r;       }
-  void SetGridScatter(Double_t gridSc)  { fGridScatter    = gridSc;  }
-  void SetKtScatter(Double_t ktSc)      { fKtScatter      = ktSc;    }
-  void SetMeanGhostKt(Double_t meankt)  { fMeanGhostKt    = meankt;  }
-  void SetPluginAlgor(Int_t plugin)     { fPluginAlgor    = plugin;  }
+  void SetStrategy(const fastjet::Strategy &strat)                 { fStrategy = strat;  fDefinitionsValid = kFALSE; }
+  void SetAlgorithm(const fastjet::JetAlgorithm &algor)            { fAlgor    = algor;  fDefinitionsValid = kFALSE; }
+  void SetRecombScheme(const fastjet::RecombinationScheme &scheme) { fScheme   = scheme; fDefinitionsValid = kFALSE; }
+  void SetAreaType(const fastjet::AreaType &atype)                 { fAreaType = atype;  fDefinitionsValid = kFALSE; }
+  void SetNRepeats(Int_t nrepeat)       { fNGhostRepeats  = nrepeat; fDefinitionsValid = kFALSE; }
+  void SetGhostArea(Double_t gharea)    { fGhostArea      = gharea;  fDefinitionsValid = kFALSE; }
+  void SetMaxRap(Double_t maxrap)       { fMaxRap         = maxrap;  fDefinitionsValid = kFALSE; }
+  void SetR(Double_t r)                 { fR              = r;       fDefinitionsValid = kFALSE; }
+  void SetGridScatter(Double_t gridSc)  { fGridScatter    = gridSc;  fDefinitionsValid = kFALSE; }
+  void SetKtScatter(Double_t ktSc)      { fKtScatter      = ktSc;    fDefinitionsValid = kFALSE; }
+  void SetMeanGhostKt(Double_t meankt)  { fMeanGhostKt    = meankt;  fDefinitionsValid = kFALSE; }
+  void SetPluginAlgor(Int_t plugin)     { fPluginAlgor    = plugin;  fDefinitionsValid = kFALSE; }
+  void SetReuseDefinitions(Bool_t b = kTRUE) { fReuseDefinitions = b; }
+  void SetGhostSeed(Int_t seed1, Int_t seed2) { fGhostSeed[0] = seed1; fGhostSeed[1] = seed2; }
   void SetUseArea4Vector(Bool_t useA4v) { fUseArea4Vector = useA4v;  }
   void SetupAlgorithmfromOpt(const char *option);
   void SetupAreaTypefromOpt(const char *option);
   void SetupSchemefromOpt(const char *option);
   void SetupStrategyfromOpt(const char *option);
-  void SetLegacyMode (Bool_t mode)      { fLegacyMode ^= mode; }
+  void SetLegacyMode (Bool_t mode)      { fLegacyMode ^= mode; fDefinitionsValid = kFALSE; }
   void SetLegacyFJ();
   void SetUseExternalBkg(Bool_t b, Double_t rho, Double_t rhom) { fUseExternalBkg = b; fRho = rho; fRhom = rhom;}
   void SetRMaxAndStep(Double_t rmax, Double_t dr) {fRMax = rmax; fDRStep = dr; }
@@ -235,8 +237,14 @@ class AliFJWrapper
   std::vector<double>                      fGRDenominator;    //!
   std::vector<double>                      fGRNumeratorSub;   //!
   std::vector<double>                      fGRDenominatorSub; //!
+  Bool_t                                   fReuseDefinitions; //! keep area and jet definitions between events
+  Bool_t                                   fDefinitionsValid; //! definitions correspond to the current settings
+  Int_t                                    fGhostSeed[2];     //! random status for the ghosts, fastjet default if both 0
 
   virtual void   SubtractBackground(const Double_t median_pt = -1);
+  virtual void   BuildDefinitions();
+  virtual void   ClearDefinitions();
+  virtual void   ClearClusterSequences();
 
  private:
   AliFJWrapper();
@@ -339,8 +347,12 @@ AliFJWrapper::AliFJWrapper(const char *name, const char *title)
   , fGRDenominator()
   , fGRNumeratorSub()
   , fGRDenominatorSub()
+  , fReuseDefinitions(kFALSE)
+  , fDefinitionsValid(kFALSE)
 {
   // Constructor.
+  fGhostSeed[0] = 0;
+  fGhostSeed[1] = 0;
 }
 
 //_________________________________________________________________________________________________
@@ -354,12 +366,27 @@ AliFJWrapper::~AliFJWrapper()
 void AliFJWrapper::ClearMemory()
 {
   // Destructor.
+  ClearDefinitions();
+  ClearClusterSequences();
+}
+
+//_________________________________________________________________________________________________
+void AliFJWrapper::ClearDefinitions()
+{
+  // Delete the area, range and jet definitions.
   if (fAreaDef)           { delete fAreaDef;           fAreaDef         = NULL; }
   if (fVorAreaSpec)       { delete fVorAreaSpec;       fVorAreaSpec     = NULL; }
   if (fGhostedAreaSpec)   { delete fGhostedAreaSpec;   fGhostedAreaSpec = NULL; }
   if (fJetDef)            { delete fJetDef;            fJetDef          = NULL; }
   if (fPlugin)            { delete fPlugin;            fPlugin          = NULL; }
   if (fRange)             { delete fRange;             fRange           = NULL; }
+  fDefinitionsValid = kFALSE;
+}
+
+//_________________________________________________________________________________________________
+void AliFJWrapper::ClearClusterSequences()
+{
+  // Delete the per-event cluster sequences and helpers.
   if (fClustSeq)          { delete fClustSeq;          fClustSeq        = NULL; }
   if (fClustSeqES)          { delete fClustSeqES;        fClustSeqES        = NULL; }
   if (fClustSeqSA)        { delete fClustSeqSA;        fClustSeqSA        = NULL; }
@@ -398,6 +425,8 @@ void AliFJWrapper::CopySettingsFrom(const AliFJWrapper& wrapper)
   fUseExternalBkg   = wrapper.fUseExternalBkg;
   fRho              = wrapper.fRho;
   fRhom             = wrapper.fRhom;
+  fReuseDefinitions = wrapper.fReuseDefinitions;
+  fDefinitionsValid = kFALSE;
 }
 
 //_________________________________________________________________________________________________
@@ -412,8 +441,9 @@ void AliFJWrapper::Clear(const Option_t */*opt*/)
   fInputGhosts.clear();
   fMedUsedForBgSub = 0;
 
-  // for the moment brute force delete everything
-  ClearMemory();
+  // keep the definitions if requested, otherwise brute force delete everything
+  if (fReuseDefinitions) ClearClusterSequences();
+  else                   ClearMemory();
 }
 
 //_________________________________________________________________________________________________
@@ -692,9 +722,11 @@ void AliFJWrapper::GetMedianAndSigma(Double_t &median, Double_t &sigma, Int_t re
 }
 
 //_________________________________________________________________________________________________
-Int_t AliFJWrapper::Run()
+void AliFJWrapper::BuildDefinitions()
 {
-  // Run the actual jet finder.
+  // Create the area, range and jet definitions from the current settings.
+
+  ClearDefinitions();
 
   if (fAreaType == fj::voronoi_area) {
     // Rfact - check dependence - default is 1.
@@ -745,6 +777,25 @@ Int_t AliFJWrapper::Run()
     fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
   }
 
+  fDefinitionsValid = kTRUE;
+}
+
+//_________________________________________________________________________________________________
+Int_t AliFJWrapper::Run()
+{
+  // Run the actual jet finder.
+  // With SetReuseDefinitions() the definitions are only rebuilt after a change of the settings.
+
+  if (!fReuseDefinitions || !fDefinitionsValid) BuildDefinitions();
+
+#ifdef FASTJET_VERSION
+  // deterministic ghosts: restart the ghost random sequence from the given status
+  if (fGhostedAreaSpec && (fGhostSeed[0] != 0 || fGhostSeed[1] != 0)) {
+    std::vector<int> status(fGhostSeed, fGhostSeed + 2);
+    fGhostedAreaSpec->set_random_status(status);
+  }
+#endif
+
   try {
     fClustSeq = new fj::ClusterSequenceArea(fInputVectors, *fJetDef, *fAreaDef);
     if(fEventSub){
@@ -779,7 +830,11 @@ Int_t AliFJWrapper::Filter()
 //  AliFJWrapper::Filter
 //
 
-  fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
+  if (fReuseDefinitions) {
+    if (!fDefinitionsValid) BuildDefinitions();
+  } else {
+    fJetDef = new fj::JetDefinition(fAlgor, fR, fScheme, fStrategy);
+  }
 
   if (fDoFilterArea) {
     if (fInputGhosts.size()>0) {
@@ -1355,6 +1410,7 @@ Int_t AliFJWrapper::CreateEventConstituentSub() {
 void AliFJWrapper::SetupAlgorithmfromOpt(const char *option)
 {
   // Setup algorithm from char.
+  fDefinitionsValid = kFALSE;
 
   std::string opt(option);
 
@@ -1373,6 +1429,7 @@ void AliFJWrapper::SetupAlgorithmfromOpt(const char *option)
 void AliFJWrapper::SetupAreaTypefromOpt(const char *option)
 {
   // Setup area type from char.
+  fDefinitionsValid = kFALSE;
 
   std::string opt(option);
 
@@ -1390,6 +1447,7 @@ void AliFJWrapper::SetupSchemefromOpt(const char *option)
   //
   // setup scheme from char
   //
+  fDefinitionsValid = kFALSE;
 
   std::string opt(option);
 
@@ -1406,6 +1464,7 @@ void AliFJWrapper::SetupSchemefromOpt(const char *option)
 void AliFJWrapper::SetupStrategyfromOpt(const char *option)
 {
   // Setup strategy from char.
+  fDefinitionsValid = kFALSE;
 
   std::string opt(option);
 
@@ -1430,6 +1489,7 @@ Double_t AliFJWrapper::NSubjettiness(Int_t N, Int_t Algorithm, Double_t Radius,
   //Option 0=Nsubjettiness result, 1=opening angle between axes in Eta-Phi plane, 2=Distance between axes in Eta-Phi plane
   
   fJetDef = new fj::JetDefinition(fAlgor, fR*2, fScheme, fStrategy ); //the *2 is becasue of a handful of jets that end up missing a track for some reason.
+  fDefinitionsValid = kFALSE; // fJetDef no longer matches the settings
 
   try {
     fClustSeqSA = new fastjet::ClusterSequence(fInputVectors, *fJetDef);
@@ -60,7 +60,16 @@ AliFMDDensityCalculator::AliFMDDensityCalculator()
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fStripLookupNIpZ(0),
+    fStripLookupMinIpZ(-10),
+    fStripLookupMaxIpZ(10),
+    fStripEta(),
+    fStripPhi(),
+    fStripCut(),
+    fStripAcc(),
+    fStripBin(),
+    fStripFilled()
 {
   // 
   // Constructor 
@@ -98,7 +107,16 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const char* title)
     fDoTiming(false),
     fHTiming(0), 
     fMaxOutliers(0.05),
-    fOutlierCut(0.50)
+    fOutlierCut(0.50),
+    fStripLookupNIpZ(0),
+    fStripLookupMinIpZ(-10),
+    fStripLookupMaxIpZ(10),
+    fStripEta(),
+    fStripPhi(),
+    fStripCut(),
+    fStripAcc(),
+    fStripBin(),
+    fStripFilled()
 {
   // 
   // Constructor 
@@ -167,7 +185,16 @@ AliFMDDensityCalculator::AliFMDDensityCalculator(const
     fDoTiming(o.fDoTiming),
     fHTiming(o.fHTiming), 
   fMaxOutliers(o.fMaxOutliers),
-  fOutlierCut(o.fOutlierCut)
+  fOutlierCut(o.fOutlierCut),
+  fStripLookupNIpZ(o.fStripLookupNIpZ),
+  fStripLookupMinIpZ(o.fStripLookupMinIpZ),
+  fStripLookupMaxIpZ(o.fStripLookupMaxIpZ),
+  fStripEta(),
+  fStripPhi(),
+  fStripCut(),
+  fStripAcc(),
+  fStripBin(),
+  fStripFilled()
 {
   // 
   // Copy constructor 
@@ -232,6 +259,10 @@ AliFMDDensityCalculator::operator=(const AliFMDDensityCalculator& o)
   fHTiming            = o.fHTiming;
   fMaxOutliers        = o.fMaxOutliers;
   fOutlierCut         = o.fOutlierCut;
+  fStripLookupNIpZ    = o.fStripLookupNIpZ;
+  fStripLookupMinIpZ  = o.fStripLookupMinIpZ;
+  fStripLookupMaxIpZ  = o.fStripLookupMaxIpZ;
+  fStripFilled.Set(0);
 
   fRingHistos.Delete();
   TIter    next(&o.fRingHistos);
@@ -254,6 +285,19 @@ AliFMDDensityCalculator::SetupForData(const TAxis& axis)
  
   fCache.Init(axis);
 
+  // Strip look-up table - 5 rings of 10240 strips per IP bin.  The
+  // table of each IP bin and ring is filled by the first event seen.
+  if (fStripLookupNIpZ > 0) {
+    Int_t nStrips = fStripLookupNIpZ * 5 * 20 * 512;
+    fStripEta.Set(nStrips);
+    fStripPhi.Set(nStrips);
+    fStripCut.Set(nStrips);
+    fStripAcc.Set(nStrips);
+    fStripBin.Set(nStrips);
+    fStripFilled.Set(fStripLookupNIpZ * 5);
+    fStripFilled.Reset(0);
+  }
+
   TIter    next(&fRingHistos);
   RingHistos* o = 0;
   while ((o = static_cast<RingHistos*>(next()))) {
@@ -343,6 +387,37 @@ AliFMDDensityCalculator::GetMultCut(UShort_t d, Char_t r, Double_t eta,
   // return fCuts.GetMultCut(d,r,eta,errors);
 }
 
+//____________________________________________________________________
+Int_t
+AliFMDDensityCalculator::GetStripLookupOffset(const TVector3& ip, 
+					      Int_t ring) const
+{
+  // 
+  // Get the offset of the strip look-up table of a ring for the
+  // interaction point ip, or -1 if the table is not used
+  //
+  if (fStripLookupNIpZ <= 0 || 
+      fStripFilled.GetSize() != fStripLookupNIpZ * 5) return -1;
+  Double_t z = ip.Z();
+  if (z < fStripLookupMinIpZ || z >= fStripLookupMaxIpZ) return -1;
+  Int_t iz = Int_t(fStripLookupNIpZ * (z - fStripLookupMinIpZ) / 
+		   (fStripLookupMaxIpZ - fStripLookupMinIpZ));
+  if (iz >= fStripLookupNIpZ) iz = fStripLookupNIpZ - 1;
+  return (iz * 5 + ring) * 20 * 512;
+}
+
+namespace {
+  void FillBin(TH2D* h, Int_t bin, Double_t w)
+  {
+    // Same as TH2D::Fill(x,y,w) for a known global bin, except that
+    // the axis statistics (means and RMS's) are not updated 
+    if (!h->GetSumw2N() && w != 1 && !h->TestBit(TH1::kIsNotW)) h->Sumw2();
+    h->AddBinContent(bin, w);
+    if (h->GetSumw2N()) h->GetSumw2()->fArray[bin] += w*w;
+    h->SetEntries(h->GetEntries()+1);
+  }
+}
+
 #ifndef NO_TIMING
 # define START_TIMER(T) if (fDoTiming) T.Start(true)
 # define GET_TIMER(T,V) if (fDoTiming) V = T.CpuTime()
@@ -430,11 +505,65 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
       // etaCache.Reset(AliESDFMD::kInvalidEta);
       // phiCache.Reset(AliESDFMD::kInvalidEta);
 
+      // --- Strip look-up table for this IP bin ---------------------
+      // If the table is filled, eta, phi, cut, acceptance correction,
+      // and output bin are read from it.  Otherwise, if the IP is
+      // within the table range, this event fills it.
+      Int_t  lutOff  = GetStripLookupOffset(ip, (d == 1 ? 0 : 2*d-3+q));
+      Int_t  lutIdx  = lutOff / (20*512);
+      Bool_t useLut  = (lutOff >= 0 && fStripFilled.fArray[lutIdx]);
+      Bool_t fillLut = (lutOff >= 0 && !useLut);
+      const Double_t* etas = (useLut ? &(fStripEta.fArray[lutOff]) : etaCache);
+      const Double_t* phis = (useLut ? &(fStripPhi.fArray[lutOff]) : phiCache);
+
       // --- Loop over sectors and strips ----------------------------
       for (UShort_t s=0; s<ns; s++) { 
 	for (UShort_t t=0; t<nt; t++) {
 	  
 	  Float_t  mult   = fmd.Multiplicity(d,r,s,t);
+	  if (useLut) { 
+	    // --- Same as below, but with the cached geometry ---------
+	    Int_t    i   = lutOff + s*nt + t;
+	    Double_t eta = etas[s*nt+t];
+	    Double_t phi = phis[s*nt+t];
+	    rh->fTotal->Fill(eta);
+	    if (mult == AliESDFMD::kInvalidMult) { 
+	      rh->fELoss->Fill(-1);
+	      continue;
+	    }
+	    if (mult > 20) 
+	      AliWarningF("Raw multiplicity of FMD%d%c[%02d,%03d] = %f > 20",
+			  d, r, s, t, mult);
+	    rh->fGood->Fill(eta);
+	    Float_t acc = fStripAcc.fArray[i];
+	    if (fUsePhiAcceptance == kPhiCorrectELoss) mult *= acc;
+	    Double_t cut = fStripCut.fArray[i];
+	    START_TIMER(timer);
+	    Double_t n   = 0;
+	    if (cut > 0 && mult > cut) n = NParticles(mult,d,r,eta,lowFlux);
+	    rh->fELoss->Fill(mult);
+	    ADD_TIMER(timer,nPartTime);
+	    Double_t c = (fUsePhiAcceptance == kPhiCorrectNch ? acc : 1);
+	    fCorrections->Fill(c);
+	    if (c > 0) n /= c;
+	    rh->fCorr  ->Fill(eta, c);
+	    Bool_t hit = (n > fHitThreshold && c > 0);
+	    if (hit) {
+	      rh->fELossUsed->Fill(mult);
+	      if (fRecalculatePhi) {
+		Double_t oldEta = fmd.Eta(d,r,s,t);
+		rh->fPhiBefore->Fill(fmd.Phi(d,r,s,t) * TMath::DegToRad());
+		rh->fPhiAfter->Fill(phi);
+		rh->fEtaBefore->Fill(oldEta);
+		rh->fEtaAfter->Fill(oldEta);
+	      }
+	      rh->fSignal->Fill(eta, mult);
+	    }
+	    rh->fPoisson.Fill(t,s,hit,1./c);
+	    FillBin(h, fStripBin.fArray[i], n);
+	    if (!fUsePoisson) rh->fDensity->Fill(eta,phi,n);
+	    continue;
+	  }
 	  Double_t phi    = fmd.Phi(d,r,s,t) * TMath::DegToRad();
 	  Double_t eta    = fmd.Eta(d,r,s,t);
 	  Double_t oldPhi = phi;
@@ -458,6 +587,15 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	  START_TIMER(timer);
 	  etaCache[s*nt+t] = eta;
 	  phiCache[s*nt+t] = phi;
+	  if (fillLut) { 
+	    Int_t i = lutOff + s*nt + t;
+	    fStripEta.fArray[i] = eta;
+	    fStripPhi.fArray[i] = phi;
+	    fStripAcc.fArray[i] = AcceptanceCorrection(r,t);
+	    fStripCut.fArray[i] = (eta != AliESDFMD::kInvalidEta ? 
+				   GetMultCut(d, r, eta, false) : 1024);
+	    fStripBin.fArray[i] = h->FindBin(eta, phi);
+	  }
 
 	  // --- Check this strip ------------------------------------
 	  rh->fTotal->Fill(eta);
@@ -535,6 +673,7 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	  if (!fUsePoisson) rh->fDensity->Fill(eta,phi,n);
 	} // for t
       } // for s 
+      if (fillLut) fStripFilled.fArray[lutIdx] = 1;
 
       // --- Automatic acceptance - Calculate as an efficiency -------
       // This is very fast, so we do not bother to time it 
@@ -567,8 +706,8 @@ AliFMDDensityCalculator::Calculate(const AliESDFMD&        fmd,
 	  Double_t poissonV = poisson->GetBinContent(t+1,s+1);
 	  // Use cached eta - since the calls to GetEtaFromStrip and
 	  // GetPhiFromStrip are _very_ expensive
-	  Double_t  phi  = phiCache[s*nt+t];
-	  Double_t  eta  = etaCache[s*nt+t]; 
+	  Double_t  phi  = phis[s*nt+t];
+	  Double_t  eta  = etas[s*nt+t]; 
 	  // Double_t  phi  = fmd.Phi(d,r,s,t) * TMath::DegToRad();
 	  // Double_t  eta  = fmd.Eta(d,r,s,t);
 	  if (fUsePoisson) {
@@ -1201,6 +1340,11 @@ AliFMDDensityCalculator::Print(Option_t* option) const
   PFV("Threshold(hit)",         fHitThreshold);
   PFV("Max(outliers)",          fMaxOutliers);
   PFV("Cut(outlier)",           fOutlierCut);
+  if (fStripLookupNIpZ > 0) 
+    PFV("Strip look-up", Form("%d IP z bins in [%f,%f)", fStripLookupNIpZ,
+			      fStripLookupMinIpZ, fStripLookupMaxIpZ));
+  else
+    PFB("Strip look-up",        false);
   PFV("Lower cut", "");
   fCuts.Print();
 
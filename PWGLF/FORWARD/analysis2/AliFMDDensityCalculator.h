@@ -16,6 +16,9 @@
 #include <TNamed.h>
 #include <TList.h>
 #include <TArrayI.h>
+#include <TArrayF.h>
+#include <TArrayD.h>
+#include <TArrayC.h>
 #include <TVector3.h>
 #include "AliForwardUtil.h"
 #include "AliFMDMultCuts.h"
@@ -211,6 +214,30 @@ public:
    * @param cut Cut value 
    */
   void SetHitThreshold(Double_t cut=0.9) { fHitThreshold = cut; }
+  /** 
+   * Use a look-up table of the strip geometry.  For each bin in the
+   * interaction point @f$ z@f$ coordinate, the @f$\eta@f$,
+   * @f$\varphi@f$, low multiplicity cut, acceptance correction, and
+   * output histogram bin of all strips are stored when the first
+   * event in that bin is seen, and re-used for all following events
+   * in the same bin.  Events outside the range are processed strip by
+   * strip as usual.
+   *
+   * Note, that the geometry of an event is then that of the first
+   * event in the same IP bin, so the bins should be small compared
+   * to the @f$\eta@f$ bins.  If phi is recalculated for the (x,y)
+   * offset of the IP, the beam spot is assumed to be stable.
+   * 
+   * @param nIpZ   Number of IP z bins (0 disables the table)
+   * @param minIpZ Least IP z 
+   * @param maxIpZ Largest IP z 
+   */
+  void SetStripLookup(Int_t nIpZ=20, Double_t minIpZ=-10, Double_t maxIpZ=10) 
+  { 
+    fStripLookupNIpZ  = (nIpZ < 0 ? 0 : nIpZ); 
+    fStripLookupMinIpZ = minIpZ; 
+    fStripLookupMaxIpZ = maxIpZ; 
+  }
   /** 
    * Get the multiplicity cut.  If the user has set fMultCut (via
    * SetMultCut) then that value is used.  If not, then the lower
@@ -387,6 +414,16 @@ protected:
   virtual Bool_t CheckOutlier(Double_t eloss, 
 			      Double_t poisson,
 			      Double_t cut=0.5) const;
+  /** 
+   * Get the offset of the strip look-up table of a ring for the
+   * interaction point @a ip
+   * 
+   * @param ip    Interaction point 
+   * @param ring  Ring index (0: FMD1i, 1: FMD2i, 2: FMD2o, 3: FMD3i, 4: FMD3o)
+   * 
+   * @return Offset in the table, or -1 if not used for this IP
+   */
+  Int_t GetStripLookupOffset(const TVector3& ip, Int_t ring) const;
   /** 
    * Internal data structure to keep track of the histograms.  Never
    * streamed.
@@ -504,8 +541,17 @@ protected:
   TProfile*              fHTiming;
   Double_t               fMaxOutliers; // Maximum ratio of outlier bins 
   Double_t               fOutlierCut;  // Maximum relative diviation 
+  Int_t                  fStripLookupNIpZ;   // IP z bins of strip table
+  Double_t               fStripLookupMinIpZ; // Least IP z of strip table
+  Double_t               fStripLookupMaxIpZ; // Largest IP z of strip table
+  TArrayD                fStripEta;    //! Cached eta per IP bin and strip
+  TArrayD                fStripPhi;    //! Cached phi per IP bin and strip
+  TArrayD                fStripCut;    //! Cached low cut per IP bin and strip
+  TArrayF                fStripAcc;    //! Cached acceptance correction
+  TArrayI                fStripBin;    //! Cached output histogram bin
+  TArrayC                fStripFilled; //! Whether table of IP bin,ring is set
 
-  ClassDef(AliFMDDensityCalculator,16); // Calculate Nch density 
+  ClassDef(AliFMDDensityCalculator,17); // Calculate Nch density 
 };
 
 #endif
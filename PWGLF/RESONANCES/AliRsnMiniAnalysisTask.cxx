@@ -14,10 +14,13 @@
 //
 
 #include <Riostream.h>
+#include <algorithm>
+#include <vector>
 
 #include <TH1.h>
 #include <TList.h>
 #include <TTree.h>
+#include <TBranch.h>
 #include <TStopwatch.h>
 #include "TRandom.h"
 
@@ -494,7 +497,7 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
    // prepare variables
    Int_t ievt, nEvents = (Int_t)fEvBuffer->GetEntries();
    Int_t idef, nDefs   = fHistograms.GetEntries();
-   Int_t imix, iloop, ifill;
+   Int_t imix, ifill;
    AliRsnMiniOutput *def = 0x0;
    AliRsnMiniOutput::EComputation compType;
 
@@ -562,66 +565,37 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
       return;
    }
 
-   // initialize mixing counter
-   Int_t    nmatched[nEvents];
-   TString *smatched = new TString[nEvents];
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      smatched[ievt] = "|";
-      nmatched[ievt] = 0;
-   }
-
+   // initialize mixing counter and lists of mixing partners
+   // (each event gets at most fNMix partners in its own list)
+   std::vector<Int_t> nmatched(nEvents, 0);
+   std::vector<Int_t> npartners(nEvents, 0);
+   std::vector<Int_t> partners((Long64_t)nEvents * fNMix, 0);
 
    AliInfo(Form("[%s] Std.Event %d/%d",GetName(), nEvents,nEvents));
    timer.Stop(); timer.Print(); timer.Start(); fflush(stdout);
 
    // search for good matchings
-   for (ievt = 0; ievt < nEvents; ievt++) {
-      if (printNum&&(ievt%printNum==0)) {
-         AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
-         timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
-      }
-      if (nmatched[ievt] >= fNMix) continue;
-      fEvBuffer->GetEntry(ievt);
-      AliRsnMiniEvent evMain(*fMiniEvent);
-      for (iloop = 1; iloop < nEvents; iloop++) {
-         imix = ievt + iloop;
-         if (imix >= nEvents) imix -= nEvents;
-         if (imix == ievt) continue;
-         // text next entry
-         fEvBuffer->GetEntry(imix);
-         // skip if events are not matched
-         if (!EventsMatch(&evMain, fMiniEvent)) continue;
-         // check that the array of good matches for mixed does not already contain main event
-         if (smatched[imix].Contains(Form("|%d|", ievt))) continue;
-         // check that the found good events has not enough matches already
-         if (nmatched[imix] >= fNMix) continue;
-         // add new mixing candidate
-         smatched[ievt].Append(Form("%d|", imix));
-         nmatched[ievt]++;
-         nmatched[imix]++;
-         if (nmatched[ievt] >= fNMix) break;
-      }
-      AliDebugClass(1, Form("Matches for event %5d = %d [%s] (missing are declared above)", evMain.ID(), nmatched[ievt], smatched[ievt].Data()));
-   }
+   FindMixingPartners(nEvents, nmatched.data(), partners.data(), npartners.data(), printNum, timer);
 
    AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout); timer.Start();
 
    // perform mixing
-   TObjArray *list = 0x0;
-   TObjString *os = 0x0;
+   // partners are read in increasing entry order, so that the buffer is
+   // mostly read forward (they are usually close to the main event)
    for (ievt = 0; ievt < nEvents; ievt++) {
       if (printNum&&(ievt%printNum==0)) {
          AliInfo(Form("[%s] EventMixing %d/%d",GetName(),ievt,nEvents));
          timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
       }
+      if (npartners[ievt] < 1) continue;
       ifill = 0;
       fEvBuffer->GetEntry(ievt);
       AliRsnMiniEvent evMain(*fMiniEvent);
-      list = smatched[ievt].Tokenize("|");
-      TObjArrayIter next(list);
-      while ( (os = (TObjString *)next()) ) {
-         imix = os->GetString().Atoi();
+      Int_t *list = &partners[(Long64_t)ievt * fNMix];
+      std::sort(list, list + npartners[ievt]);
+      for (Int_t ipart = 0; ipart < npartners[ievt]; ipart++) {
+         imix = list[ipart];
          fEvBuffer->GetEntry(imix);
          for (idef = 0; idef < nDefs; idef++) {
             def = (AliRsnMiniOutput *)fHistograms[idef];
@@ -634,11 +608,8 @@ void AliRsnMiniAnalysisTask::FinishTaskOutput()
             }
          }
       }
-      delete list;
    }
 
-   delete [] smatched;
-
    AliInfo(Form("[%s] EventMixing %d/%d",GetName(),nEvents,nEvents));
    timer.Stop(); timer.Print(); fflush(stdout);
 
@@ -1455,33 +1426,34 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
 //
 
    if (!event1 || !event2) return kFALSE;
+   return KeysMatch(event1->Vz(), event1->Mult(), event1->Angle(), event2->Vz(), event2->Mult(), event2->Angle());
+}
+
+//__________________________________________________________________________________________________
+Bool_t AliRsnMiniAnalysisTask::KeysMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const
+{
+//
+// Same as EventsMatch, using only the values of vz, mult and angle of the two events.
+//
+
    Int_t ivz1, ivz2, imult1, imult2, iangle1, iangle2;
    Double_t dv, dm, da;
 
    if (fContinuousMix) {
-      dv = TMath::Abs(event1->Vz()    - event2->Vz()   );
-      dm = TMath::Abs(event1->Mult()  - event2->Mult() );
-      da = TMath::Abs(event1->Angle() - event2->Angle());
-      if (dv > fMaxDiffVz) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Vz = %f", event1->ID(), event2->ID(), dv));
-         return kFALSE;
-      }
-      if (dm > fMaxDiffMult ) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Mult = %f", event1->ID(), event2->ID(), dm));
-         return kFALSE;
-      }
-      if (da > fMaxDiffAngle) {
-         //AliDebugClass(2, Form("Events #%4d and #%4d don't match due to a too large diff in Angle = %f", event1->ID(), event2->ID(), da));
-         return kFALSE;
-      }
+      dv = TMath::Abs(vz1    - vz2   );
+      dm = TMath::Abs(mult1  - mult2 );
+      da = TMath::Abs(angle1 - angle2);
+      if (dv > fMaxDiffVz) return kFALSE;
+      if (dm > fMaxDiffMult ) return kFALSE;
+      if (da > fMaxDiffAngle) return kFALSE;
       return kTRUE;
    } else {
-      ivz1 = (Int_t)(event1->Vz() / fMaxDiffVz);
-      ivz2 = (Int_t)(event2->Vz() / fMaxDiffVz);
-      imult1 = (Int_t)(event1->Mult() / fMaxDiffMult);
-      imult2 = (Int_t)(event2->Mult() / fMaxDiffMult);
-      iangle1 = (Int_t)(event1->Angle() / fMaxDiffAngle);
-      iangle2 = (Int_t)(event2->Angle() / fMaxDiffAngle);
+      ivz1 = (Int_t)(vz1 / fMaxDiffVz);
+      ivz2 = (Int_t)(vz2 / fMaxDiffVz);
+      imult1 = (Int_t)(mult1 / fMaxDiffMult);
+      imult2 = (Int_t)(mult2 / fMaxDiffMult);
+      iangle1 = (Int_t)(angle1 / fMaxDiffAngle);
+      iangle2 = (Int_t)(angle2 / fMaxDiffAngle);
       if (ivz1 != ivz2) return kFALSE;
       if (imult1 != imult2) return kFALSE;
       if (iangle1 != iangle2) return kFALSE;
@@ -1489,6 +1461,198 @@ Bool_t AliRsnMiniAnalysisTask::EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEv
    }
 }
 
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::LoadMixingKeys(Int_t nEvents, Float_t *vz, Float_t *mult, Float_t *angle)
+{
+//
+// Read vz, mult and angle of all mini-events in the buffer.
+// If the buffer is split, only the branches of these three values are read,
+// otherwise the complete mini-events.
+//
+
+   TBranch *bevents = fEvBuffer->GetBranch("events");
+   TBranch *bvz     = bevents ? bevents->FindBranch("fVz")    : 0x0;
+   TBranch *bmult   = bevents ? bevents->FindBranch("fMult")  : 0x0;
+   TBranch *bangle  = bevents ? bevents->FindBranch("fAngle") : 0x0;
+   Bool_t   split   = (bvz && bmult && bangle);
+   if (!split) AliDebugClass(1, "Event buffer is not split, reading complete mini-events for mixing");
+
+   for (Int_t ievt = 0; ievt < nEvents; ievt++) {
+      if (split) {
+         bvz->GetEntry(ievt);
+         bmult->GetEntry(ievt);
+         bangle->GetEntry(ievt);
+      } else {
+         fEvBuffer->GetEntry(ievt);
+      }
+      vz[ievt]    = fMiniEvent->Vz();
+      mult[ievt]  = fMiniEvent->Mult();
+      angle[ievt] = fMiniEvent->Angle();
+   }
+}
+
+//__________________________________________________________________________________________________
+void AliRsnMiniAnalysisTask::FindMixingPartners(Int_t nEvents, Int_t *nmatched, Int_t *partners, Int_t *npartners, Int_t printNum, TStopwatch &timer)
+{
+//
+// Find the mixing partners of all events in the buffer.
+// For each event, the following events (restarting from the first one after the last)
+// are checked in order, and each compatible one which has less than fNMix matches yet
+// and was not already matched with the same event is added to its list, 
+// until the event has fNMix matches.
+// The list of partners of event i is stored in partners[i*fNMix], ..., partners[i*fNMix+npartners[i]-1].
+//
+// Only vz, mult and angle are kept in memory, and events are grouped in cells of these 
+// three values such that compatible events are always in the same cell (binned mixing)
+// or in neighbouring cells (continuous mixing). So only the events in these cells need to be checked.
+//
+
+   // event keys
+   std::vector<Float_t> keys[3];
+   for (Int_t ik = 0; ik < 3; ik++) keys[ik].resize(nEvents);
+   LoadMixingKeys(nEvents, keys[0].data(), keys[1].data(), keys[2].data());
+
+   // cells
+   // binned mixing: the bin used in KeysMatch
+   // continuous mixing: cells slightly larger than the maximum difference, 
+   // so that compatible events are at most in the next cell (an axis is not split
+   // if the maximum difference is not positive or too small compared to the values)
+   Double_t maxDiff[3] = {fMaxDiffVz, fMaxDiffMult, fMaxDiffAngle};
+   Double_t width[3]   = {0.0, 0.0, 0.0};
+   Int_t    nNeighbours[3] = {0, 0, 0};
+   for (Int_t ik = 0; ik < 3; ik++) {
+      if (!fContinuousMix) {
+         width[ik] = maxDiff[ik];
+         continue;
+      }
+      if (!(maxDiff[ik] > 0.0)) continue;
+      Double_t maxAbs = 0.0;
+      for (Int_t ievt = 0; ievt < nEvents; ievt++) maxAbs = TMath::Max(maxAbs, (Double_t)TMath::Abs(keys[ik][ievt]));
+      if (maxAbs / maxDiff[ik] > 1E8) continue;
+      width[ik] = maxDiff[ik] * 1.001;
+      nNeighbours[ik] = 1;
+   }
+   std::vector<Int_t> cells[3];
+   for (Int_t ik = 0; ik < 3; ik++) {
+      cells[ik].assign(nEvents, 0);
+      if (width[ik] == 0.0) continue;
+      for (Int_t ievt = 0; ievt < nEvents; ievt++) {
+         if (fContinuousMix)
+            cells[ik][ievt] = (Int_t)TMath::Floor(keys[ik][ievt] / width[ik]);
+         else
+            cells[ik][ievt] = (Int_t)(keys[ik][ievt] / width[ik]);
+      }
+   }
+
+   // events sorted by cell, and by index inside each cell
+   std::vector<Int_t> sorted(nEvents);
+   for (Int_t ievt = 0; ievt < nEvents; ievt++) sorted[ievt] = ievt;
+   std::sort(sorted.begin(), sorted.end(), [&cells](Int_t a, Int_t b) {
+      for (Int_t ik = 0; ik < 3; ik++) {
+         if (cells[ik][a] != cells[ik][b]) return cells[ik][a] < cells[ik][b];
+      }
+      return a < b;
+   });
+
+   // comparison of the cell of an event with a given cell
+   auto cellLess = [&cells](Int_t a, const Int_t *c) {
+      for (Int_t ik = 0; ik < 3; ik++) {
+         if (cells[ik][a] != c[ik]) return cells[ik][a] < c[ik];
+      }
+      return false;
+   };
+   auto cellGreater = [&cells](const Int_t *c, Int_t a) {
+      for (Int_t ik = 0; ik < 3; ik++) {
+         if (cells[ik][a] != c[ik]) return c[ik] < cells[ik][a];
+      }
+      return false;
+   };
+
+   // cursors running over the (at most 27) cells to be checked, starting after the main event
+   const Int_t maxCursors = 27;
+   Int_t cursorBegin[maxCursors], cursorEnd[maxCursors], cursorPos[maxCursors], cursorStart[maxCursors];
+   Bool_t cursorWrapped[maxCursors];
+   Int_t  imix;
+
+   for (Int_t ievt = 0; ievt < nEvents; ievt++) {
+      if (printNum&&(ievt%printNum==0)) {
+         AliInfo(Form("[%s] EventMixing searching %d/%d",GetName(),ievt,nEvents));
+         timer.Stop(); timer.Print(); timer.Start(kFALSE); fflush(stdout);
+      }
+      if (nmatched[ievt] >= fNMix) continue;
+
+      // locate the cells
+      Int_t nCursors = 0;
+      Int_t cell[3];
+      for (Int_t d0 = -nNeighbours[0]; d0 <= nNeighbours[0]; d0++) {
+         for (Int_t d1 = -nNeighbours[1]; d1 <= nNeighbours[1]; d1++) {
+            for (Int_t d2 = -nNeighbours[2]; d2 <= nNeighbours[2]; d2++) {
+               cell[0] = cells[0][ievt] + d0;
+               cell[1] = cells[1][ievt] + d1;
+               cell[2] = cells[2][ievt] + d2;
+               // first and last+1 position of events in this cell, and first event after the main one
+               std::vector<Int_t>::iterator first = std::lower_bound(sorted.begin(), sorted.end(), (const Int_t *)cell, cellLess);
+               std::vector<Int_t>::iterator last  = std::upper_bound(first, sorted.end(), (const Int_t *)cell, cellGreater);
+               if (first == last) continue;
+               std::vector<Int_t>::iterator after = std::upper_bound(first, last, ievt);
+               cursorBegin[nCursors]   = first - sorted.begin();
+               cursorEnd[nCursors]     = last - sorted.begin();
+               cursorStart[nCursors]   = after - sorted.begin();
+               cursorPos[nCursors]     = cursorStart[nCursors];
+               cursorWrapped[nCursors] = kFALSE;
+               if (cursorPos[nCursors] == cursorEnd[nCursors]) {
+                  cursorPos[nCursors] = cursorBegin[nCursors];
+                  cursorWrapped[nCursors] = kTRUE;
+               }
+               nCursors++;
+            }
+         }
+      }
+
+      // loop over the candidates in the same order as the events following the main one
+      while (nmatched[ievt] < fNMix) {
+         // candidate with the smallest distance after the main event
+         Int_t best = -1, bestDist = nEvents;
+         for (Int_t icur = 0; icur < nCursors; icur++) {
+            if (cursorWrapped[icur] && cursorPos[icur] >= cursorStart[icur]) continue;
+            Int_t dist = sorted[cursorPos[icur]] - ievt;
+            if (dist < 0) dist += nEvents;
+            if (dist < bestDist) {
+               bestDist = dist;
+               best = icur;
+            }
+         }
+         if (best < 0) break;
+         imix = sorted[cursorPos[best]];
+         cursorPos[best]++;
+         if (!cursorWrapped[best] && cursorPos[best] == cursorEnd[best]) {
+            cursorPos[best] = cursorBegin[best];
+            cursorWrapped[best] = kTRUE;
+         }
+         if (imix == ievt) continue;
+         // skip if events are not matched
+         if (!KeysMatch(keys[0][ievt], keys[1][ievt], keys[2][ievt], keys[0][imix], keys[1][imix], keys[2][imix])) continue;
+         // check that the list of good matches for mixed does not already contain main event
+         Bool_t found = kFALSE;
+         for (Int_t ipart = 0; ipart < npartners[imix]; ipart++) {
+            if (partners[(Long64_t)imix * fNMix + ipart] == ievt) {
+               found = kTRUE;
+               break;
+            }
+         }
+         if (found) continue;
+         // check that the found good events has not enough matches already
+         if (nmatched[imix] >= fNMix) continue;
+         // add new mixing candidate
+         partners[(Long64_t)ievt * fNMix + npartners[ievt]] = imix;
+         npartners[ievt]++;
+         nmatched[ievt]++;
+         nmatched[imix]++;
+      }
+      AliDebugClass(1, Form("Matches for event %5d = %d (missing are declared above)", ievt, nmatched[ievt]));
+   }
+}
+
 //---------------------------------------------------------------------
 Double_t AliRsnMiniAnalysisTask::ApplyCentralityPatchPbPb2011(){
   //This part rejects randomly events such that the centrality gets flat for LHC11h Pb-Pb data
@@ -24,6 +24,7 @@
 #include "AliRsnCutPrimaryVertex.h"
 
 class TList;
+class TStopwatch;
 
 class AliTriggerAnalysis;
 class AliRsnMiniEvent;
@@ -101,6 +102,9 @@ private:
    void     FillTrueMotherAOD(AliRsnMiniEvent *event);
    void     StoreTrueMother(AliRsnMiniPair *pair, AliRsnMiniEvent *event);
    Bool_t   EventsMatch(AliRsnMiniEvent *event1, AliRsnMiniEvent *event2);
+   Bool_t   KeysMatch(Float_t vz1, Float_t mult1, Float_t angle1, Float_t vz2, Float_t mult2, Float_t angle2) const;
+   void     LoadMixingKeys(Int_t nEvents, Float_t *vz, Float_t *mult, Float_t *angle);
+   void     FindMixingPartners(Int_t nEvents, Int_t *nmatched, Int_t *partners, Int_t *npartners, Int_t printNum, TStopwatch &timer);
    AliQnCorrectionsQnVector * GetQnVectorFromList(const TList *list,
                                                         const char *subdetector,
                                                         const char *expectedstep) const;
@@ -118,11 +118,35 @@ class AliAODv0;
 #include "AliEventCuts.h"
 #include "AliV0Result.h"
 #include "AliCascadeResult.h"
+#include "AliWeakResultCutEngine.h"
 #include "AliAnalysisTaskStrangenessVsMultiplicityRun2.h"
 
 using std::cout;
 using std::endl;
 
+namespace {
+    //Variables of the simple threshold cuts evaluated with AliWeakResultCutEngine
+    enum EV0CutVariable {
+        kV0NegEtaMin = 0, kV0NegEtaMax, kV0PosEtaMin, kV0PosEtaMax,
+        kV0RapidityMin, kV0RapidityMax,
+        kV0RadiusMin, kV0RadiusMax,
+        kV0DCANegToPV, kV0DCAPosToPV, kV0DCAV0Daughters, kV0CosPA,
+        kV0ProperLifetime, kV0LeastCrossedRows, kV0LeastCrossedRowsOverFindable,
+        kV0BaryonMomentum, kV0NegdEdx, kV0PosdEdx,
+        kNV0CutVariables
+    };
+    enum ECascadeCutVariable {
+        kCascPosEtaMin = 0, kCascPosEtaMax, kCascNegEtaMin, kCascNegEtaMax, kCascBachEtaMin, kCascBachEtaMax,
+        kCascRapidityMin, kCascRapidityMax,
+        kCascDCANegToPV, kCascDCAPosToPV, kCascDCAV0Daughters, kCascV0CosPA, kCascV0Radius,
+        kCascDCAV0ToPV, kCascV0Mass, kCascDCABachToPV, kCascDCACascDaughters, kCascCosPA, kCascRadius,
+        kCascProperLifetime, kCascLeastClusters,
+        kCascNegdEdx, kCascPosdEdx, kCascBachdEdx,
+        kCascDCABachToBaryon, kCascMinV0Lifetime,
+        kNCascadeCutVariables
+    };
+}
+
 ClassImp(AliAnalysisTaskStrangenessVsMultiplicityRun2)
 
 AliAnalysisTaskStrangenessVsMultiplicityRun2::AliAnalysisTaskStrangenessVsMultiplicityRun2()
@@ -152,6 +176,9 @@ fkRunVertexers    ( kFALSE ),
 fkUseLightVertexer ( kTRUE ),
 fkDoV0Refit       ( kTRUE ),
 fkExtraCleanup    ( kTRUE ),
+fkUseCutEngine    ( kFALSE ),
+fV0CutEngine      ( 0x0 ),
+fCascadeCutEngine ( 0x0 ),
 
 //---> Flag controlling trigger selection
 fTrigType(AliVEvent::kMB),
@@ -377,6 +404,9 @@ fkRunVertexers    ( kFALSE ),
 fkUseLightVertexer ( kTRUE ),
 fkDoV0Refit       ( kTRUE ),
 fkExtraCleanup    ( kTRUE ),
+fkUseCutEngine    ( kFALSE ),
+fV0CutEngine      ( 0x0 ),
+fCascadeCutEngine ( 0x0 ),
 
 //---> Flag controlling trigger selection
 fTrigType(AliVEvent::kMB),
@@ -671,6 +701,14 @@ AliAnalysisTaskStrangenessVsMultiplicityRun2::~AliAnalysisTaskStrangenessVsMulti
         delete fRand;
         fRand = 0x0;
     }
+    if (fV0CutEngine) {
+        delete fV0CutEngine;
+        fV0CutEngine = 0x0;
+    }
+    if (fCascadeCutEngine) {
+        delete fCascadeCutEngine;
+        fCascadeCutEngine = 0x0;
+    }
 }
 
 //________________________________________________________________________
@@ -1509,7 +1547,50 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         //AliWarning(Form("[V0 Analyses] Processing different configurations (%i detected)",lNumberOfConfigurations));
         TH3F *histoout         = 0x0;
         AliV0Result *lV0Result = 0x0;
+        
+        //Pre-select the configurations passing the simple threshold cuts
+        //(only these need to go through the full selection below)
+        Bool_t lUseV0CutEngine = kFALSE;
+        if ( fkUseCutEngine ){
+            if ( !fV0CutEngine || fV0CutEngine->GetNConfigurations() != lNumberOfConfigurations ) BuildV0CutEngine();
+            lUseV0CutEngine = fkUseCutEngine;
+        }
+        if ( lUseV0CutEngine ){
+            fV0CutEngine->ResetSelection();
+            Double_t lCutValues[kNV0CutVariables];
+            lCutValues[kV0NegEtaMin]      = fTreeVariableNegEta;
+            lCutValues[kV0NegEtaMax]      = fTreeVariableNegEta;
+            lCutValues[kV0PosEtaMin]      = fTreeVariablePosEta;
+            lCutValues[kV0PosEtaMax]      = fTreeVariablePosEta;
+            lCutValues[kV0RadiusMin]      = fTreeVariableV0Radius;
+            lCutValues[kV0RadiusMax]      = fTreeVariableV0Radius;
+            lCutValues[kV0DCANegToPV]     = fTreeVariableDcaNegToPrimVertex;
+            lCutValues[kV0DCAPosToPV]     = fTreeVariableDcaPosToPrimVertex;
+            lCutValues[kV0DCAV0Daughters] = fTreeVariableDcaV0Daughters;
+            lCutValues[kV0CosPA]          = fTreeVariableV0CosineOfPointingAngle;
+            lCutValues[kV0LeastCrossedRows]             = fTreeVariableLeastNbrCrossedRows;
+            lCutValues[kV0LeastCrossedRowsOverFindable] = fTreeVariableLeastRatioCrossedRowsOverFindable;
+            
+            //Per mass hypothesis (same as in the configuration loop)
+            const Float_t lHypoRap[3]      = { fTreeVariableRapK0Short, fTreeVariableRapLambda, fTreeVariableRapLambda };
+            const Float_t lHypoPDGMass[3]  = { 0.497, 1.115683, 1.115683 };
+            const Float_t lHypoNegdEdx[3]  = { fTreeVariableNSigmasNegPion, fTreeVariableNSigmasNegPion, fTreeVariableNSigmasNegProton };
+            const Float_t lHypoPosdEdx[3]  = { fTreeVariableNSigmasPosPion, fTreeVariableNSigmasPosProton, fTreeVariableNSigmasPosPion };
+            const Float_t lHypoBaryonP[3]  = { 0, fTreeVariablePosInnerP, fTreeVariableNegInnerP };
+            for(Int_t ihypo=0; ihypo<3; ihypo++){
+                Float_t lProperLifetime = fTreeVariableDistOverTotMom*lHypoPDGMass[ihypo];
+                lCutValues[kV0RapidityMin]    = lHypoRap[ihypo];
+                lCutValues[kV0RapidityMax]    = lHypoRap[ihypo];
+                lCutValues[kV0ProperLifetime] = lProperLifetime;
+                lCutValues[kV0BaryonMomentum] = lHypoBaryonP[ihypo];
+                lCutValues[kV0NegdEdx]        = TMath::Abs(lHypoNegdEdx[ihypo]);
+                lCutValues[kV0PosdEdx]        = TMath::Abs(lHypoPosdEdx[ihypo]);
+                if ( lOnFlyStatus == 0 || lOnFlyStatus == 1 ) fV0CutEngine->Select(2*ihypo+lOnFlyStatus, lCutValues);
+            }
+        }
+        
         for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+            if ( lUseV0CutEngine && !fV0CutEngine->IsSelected(lcfg) ) continue;
             lV0Result = (AliV0Result*) fListV0->At(lcfg);
             histoout  = lV0Result->GetHistogram();
             
@@ -2322,7 +2403,65 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::UserExec(Option_t *)
         //AliWarning(Form("[Cascade Analyses] Processing different configurations (%i detected)",lNumberOfConfigurationsCascade));
         TH3F *histoout         = 0x0;
         AliCascadeResult *lCascadeResult = 0x0;
+        
+        //Pre-select the configurations passing the simple threshold cuts
+        //(only these need to go through the full selection below)
+        Bool_t lUseCascadeCutEngine = kFALSE;
+        if ( fkUseCutEngine ){
+            if ( !fCascadeCutEngine || fCascadeCutEngine->GetNConfigurations() != lNumberOfConfigurationsCascade ) BuildCascadeCutEngine();
+            lUseCascadeCutEngine = fkUseCutEngine;
+        }
+        if ( lUseCascadeCutEngine ){
+            fCascadeCutEngine->ResetSelection();
+            Double_t lCutValues[kNCascadeCutVariables];
+            lCutValues[kCascPosEtaMin]       = fTreeCascVarPosEta;
+            lCutValues[kCascPosEtaMax]       = fTreeCascVarPosEta;
+            lCutValues[kCascNegEtaMin]       = fTreeCascVarNegEta;
+            lCutValues[kCascNegEtaMax]       = fTreeCascVarNegEta;
+            lCutValues[kCascBachEtaMin]      = fTreeCascVarBachEta;
+            lCutValues[kCascBachEtaMax]      = fTreeCascVarBachEta;
+            lCutValues[kCascDCANegToPV]      = fTreeCascVarDCANegToPrimVtx;
+            lCutValues[kCascDCAPosToPV]      = fTreeCascVarDCAPosToPrimVtx;
+            lCutValues[kCascDCAV0Daughters]  = fTreeCascVarDCAV0Daughters;
+            lCutValues[kCascV0CosPA]         = fTreeCascVarV0CosPointingAngle;
+            lCutValues[kCascV0Radius]        = fTreeCascVarV0Radius;
+            lCutValues[kCascDCAV0ToPV]       = fTreeCascVarDCAV0ToPrimVtx;
+            lCutValues[kCascDCABachToPV]     = fTreeCascVarDCABachToPrimVtx;
+            lCutValues[kCascDCACascDaughters]= fTreeCascVarDCACascDaughters;
+            lCutValues[kCascCosPA]           = fTreeCascVarCascCosPointingAngle;
+            lCutValues[kCascRadius]          = fTreeCascVarCascRadius;
+            lCutValues[kCascLeastClusters]   = fTreeCascVarLeastNbrClusters;
+            lCutValues[kCascDCABachToBaryon] = fTreeCascVarDCABachToBaryon;
+            lCutValues[kCascMinV0Lifetime]   = fTreeCascVarV0Lifetime;
+            
+            //Per mass hypothesis (same as in the configuration loop)
+            const Int_t   lHypoCharge[4]   = { -1, +1, -1, +1 };
+            const Float_t lHypoV0Mass[4]   = { fTreeCascVarV0MassLambda, fTreeCascVarV0MassAntiLambda, fTreeCascVarV0MassLambda, fTreeCascVarV0MassAntiLambda };
+            const Float_t lHypoRap[4]      = { fTreeCascVarRapXi, fTreeCascVarRapXi, fTreeCascVarRapOmega, fTreeCascVarRapOmega };
+            const Float_t lHypoPDGMass[4]  = { 1.32171, 1.32171, 1.67245, 1.67245 };
+            const Float_t lHypoNegdEdx[4]  = { fTreeCascVarNegNSigmaPion, fTreeCascVarNegNSigmaProton, fTreeCascVarNegNSigmaPion, fTreeCascVarNegNSigmaProton };
+            const Float_t lHypoPosdEdx[4]  = { fTreeCascVarPosNSigmaProton, fTreeCascVarPosNSigmaPion, fTreeCascVarPosNSigmaProton, fTreeCascVarPosNSigmaPion };
+            const Float_t lHypoBachdEdx[4] = { fTreeCascVarBachNSigmaPion, fTreeCascVarBachNSigmaPion, fTreeCascVarBachNSigmaKaon, fTreeCascVarBachNSigmaKaon };
+            for(Int_t ihypo=0; ihypo<4; ihypo++){
+                //Charge check: configurations with or without swapped bachelor charge
+                Int_t lSwap = -1;
+                if ( fTreeCascVarCharge ==  lHypoCharge[ihypo] ) lSwap = 0;
+                if ( fTreeCascVarCharge == -lHypoCharge[ihypo] ) lSwap = 1;
+                if ( lSwap < 0 ) continue;
+                Float_t lProperLifetime = fTreeCascVarDistOverTotMom*lHypoPDGMass[ihypo];
+                lCutValues[kCascRapidityMin]    = lHypoRap[ihypo];
+                lCutValues[kCascRapidityMax]    = lHypoRap[ihypo];
+                lCutValues[kCascV0Mass]         = TMath::Abs(lHypoV0Mass[ihypo]-1.116);
+                lCutValues[kCascProperLifetime] = lProperLifetime;
+                lCutValues[kCascNegdEdx]        = TMath::Abs(lHypoNegdEdx[ihypo]);
+                lCutValues[kCascPosdEdx]        = TMath::Abs(lHypoPosdEdx[ihypo]);
+                lCutValues[kCascBachdEdx]       = TMath::Abs(lHypoBachdEdx[ihypo]);
+                fCascadeCutEngine->Select(2*ihypo+lSwap, lCutValues);
+            }
+        }
+        
         for(Int_t lcfg=0; lcfg<lNumberOfConfigurationsCascade; lcfg++){
+            if ( lUseCascadeCutEngine && !fCascadeCutEngine->IsSelected(lcfg) ) continue;
             lCascadeResult = (AliCascadeResult*) fListCascade->At(lcfg);
             histoout  = lCascadeResult->GetHistogram();
             
@@ -2678,6 +2817,111 @@ void AliAnalysisTaskStrangenessVsMultiplicityRun2::AddConfiguration( AliCascadeR
     fListCascade->Add(lCascadeResult);
 }
 
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildV0CutEngine()
+{
+    //Store the simple threshold cuts of all V0 configurations in the cut
+    //engine. All of them are necessary conditions of the full selection in
+    //UserExec, which is still applied to the configurations passing them.
+    //Groups: mass hypothesis x on-the-fly status
+    Int_t lNumberOfConfigurations = fListV0 ? fListV0->GetEntries() : 0;
+    if ( !fV0CutEngine ) fV0CutEngine = new AliWeakResultCutEngine();
+    fV0CutEngine->Init(lNumberOfConfigurations, kNV0CutVariables);
+    
+    const Int_t lUpperCuts[] = { kV0NegEtaMax, kV0PosEtaMax, kV0RapidityMax, kV0RadiusMax,
+        kV0DCAV0Daughters, kV0ProperLifetime, kV0NegdEdx, kV0PosdEdx };
+    for(UInt_t iv=0; iv<sizeof(lUpperCuts)/sizeof(lUpperCuts[0]); iv++) fV0CutEngine->SetUpperCut(lUpperCuts[iv]);
+    
+    for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+        AliV0Result *lV0Result = (AliV0Result*) fListV0->At(lcfg);
+        Int_t lHypo = lV0Result->GetMassHypothesis();
+        if ( lHypo < AliV0Result::kK0Short || lHypo > AliV0Result::kAntiLambda ){
+            AliWarning(Form("Unknown mass hypothesis in configuration %s, not using the cut engine", lV0Result->GetName()));
+            fkUseCutEngine = kFALSE;
+            return;
+        }
+        fV0CutEngine->SetGroup(lcfg, 2*lHypo + (lV0Result->GetUseOnTheFly() ? 1 : 0));
+        
+        fV0CutEngine->SetCut(lcfg, kV0NegEtaMin,   lV0Result->GetCutMinEtaTracks());
+        fV0CutEngine->SetCut(lcfg, kV0NegEtaMax,   lV0Result->GetCutMaxEtaTracks());
+        fV0CutEngine->SetCut(lcfg, kV0PosEtaMin,   lV0Result->GetCutMinEtaTracks());
+        fV0CutEngine->SetCut(lcfg, kV0PosEtaMax,   lV0Result->GetCutMaxEtaTracks());
+        fV0CutEngine->SetCut(lcfg, kV0RapidityMin, lV0Result->GetCutMinRapidity());
+        fV0CutEngine->SetCut(lcfg, kV0RapidityMax, lV0Result->GetCutMaxRapidity());
+        fV0CutEngine->SetCut(lcfg, kV0RadiusMin,   lV0Result->GetCutV0Radius());
+        fV0CutEngine->SetCut(lcfg, kV0RadiusMax,   lV0Result->GetCutMaxV0Radius());
+        fV0CutEngine->SetCut(lcfg, kV0DCANegToPV,  lV0Result->GetCutDCANegToPV());
+        fV0CutEngine->SetCut(lcfg, kV0DCAPosToPV,  lV0Result->GetCutDCAPosToPV());
+        fV0CutEngine->SetCut(lcfg, kV0DCAV0Daughters, lV0Result->GetCutDCAV0Daughters());
+        //Float_t as in UserExec; the variable cut can only be tighter
+        fV0CutEngine->SetCut(lcfg, kV0CosPA, (Float_t) lV0Result->GetCutV0CosPA());
+        fV0CutEngine->SetCut(lcfg, kV0ProperLifetime, lV0Result->GetCutProperLifetime());
+        fV0CutEngine->SetCut(lcfg, kV0LeastCrossedRows, lV0Result->GetCutLeastNumberOfCrossedRows());
+        fV0CutEngine->SetCut(lcfg, kV0LeastCrossedRowsOverFindable, lV0Result->GetCutLeastNumberOfCrossedRowsOverFindable());
+        //no baryon daughter for the K0Short
+        fV0CutEngine->SetCut(lcfg, kV0BaryonMomentum, lHypo == AliV0Result::kK0Short ? -TMath::Infinity() : lV0Result->GetCutMinBaryonMomentum());
+        fV0CutEngine->SetCut(lcfg, kV0NegdEdx, lV0Result->GetCutTPCdEdx());
+        fV0CutEngine->SetCut(lcfg, kV0PosdEdx, lV0Result->GetCutTPCdEdx());
+    }
+    fV0CutEngine->Build();
+}
+
+//________________________________________________________________________
+void AliAnalysisTaskStrangenessVsMultiplicityRun2::BuildCascadeCutEngine()
+{
+    //Store the simple threshold cuts of all cascade configurations in the
+    //cut engine, as for the V0s.
+    //Groups: mass hypothesis x bachelor charge swap
+    Int_t lNumberOfConfigurations = fListCascade ? fListCascade->GetEntries() : 0;
+    if ( !fCascadeCutEngine ) fCascadeCutEngine = new AliWeakResultCutEngine();
+    fCascadeCutEngine->Init(lNumberOfConfigurations, kNCascadeCutVariables);
+    
+    const Int_t lUpperCuts[] = { kCascPosEtaMax, kCascNegEtaMax, kCascBachEtaMax, kCascRapidityMax,
+        kCascDCAV0Daughters, kCascV0Mass, kCascDCACascDaughters, kCascProperLifetime,
+        kCascNegdEdx, kCascPosdEdx, kCascBachdEdx };
+    for(UInt_t iv=0; iv<sizeof(lUpperCuts)/sizeof(lUpperCuts[0]); iv++) fCascadeCutEngine->SetUpperCut(lUpperCuts[iv]);
+    
+    for(Int_t lcfg=0; lcfg<lNumberOfConfigurations; lcfg++){
+        AliCascadeResult *lCascadeResult = (AliCascadeResult*) fListCascade->At(lcfg);
+        Int_t lHypo = lCascadeResult->GetMassHypothesis();
+        if ( lHypo < AliCascadeResult::kXiMinus || lHypo > AliCascadeResult::kOmegaPlus ){
+            AliWarning(Form("Unknown mass hypothesis in configuration %s, not using the cut engine", lCascadeResult->GetName()));
+            fkUseCutEngine = kFALSE;
+            return;
+        }
+        fCascadeCutEngine->SetGroup(lcfg, 2*lHypo + (lCascadeResult->GetSwapBachelorCharge() ? 1 : 0));
+        
+        fCascadeCutEngine->SetCut(lcfg, kCascPosEtaMin,   lCascadeResult->GetCutMinEtaTracks());
+        fCascadeCutEngine->SetCut(lcfg, kCascPosEtaMax,   lCascadeResult->GetCutMaxEtaTracks());
+        fCascadeCutEngine->SetCut(lcfg, kCascNegEtaMin,   lCascadeResult->GetCutMinEtaTracks());
+        fCascadeCutEngine->SetCut(lcfg, kCascNegEtaMax,   lCascadeResult->GetCutMaxEtaTracks());
+        fCascadeCutEngine->SetCut(lcfg, kCascBachEtaMin,  lCascadeResult->GetCutMinEtaTracks());
+        fCascadeCutEngine->SetCut(lcfg, kCascBachEtaMax,  lCascadeResult->GetCutMaxEtaTracks());
+        fCascadeCutEngine->SetCut(lcfg, kCascRapidityMin, lCascadeResult->GetCutMinRapidity());
+        fCascadeCutEngine->SetCut(lcfg, kCascRapidityMax, lCascadeResult->GetCutMaxRapidity());
+        fCascadeCutEngine->SetCut(lcfg, kCascDCANegToPV,  lCascadeResult->GetCutDCANegToPV());
+        fCascadeCutEngine->SetCut(lcfg, kCascDCAPosToPV,  lCascadeResult->GetCutDCAPosToPV());
+        fCascadeCutEngine->SetCut(lcfg, kCascDCAV0Daughters, lCascadeResult->GetCutDCAV0Daughters());
+        //Float_t as in UserExec; the variable cuts can only be tighter
+        fCascadeCutEngine->SetCut(lcfg, kCascV0CosPA, (Float_t) lCascadeResult->GetCutV0CosPA());
+        fCascadeCutEngine->SetCut(lcfg, kCascV0Radius,    lCascadeResult->GetCutV0Radius());
+        fCascadeCutEngine->SetCut(lcfg, kCascDCAV0ToPV,   lCascadeResult->GetCutDCAV0ToPV());
+        fCascadeCutEngine->SetCut(lcfg, kCascV0Mass,      lCascadeResult->GetCutV0Mass());
+        fCascadeCutEngine->SetCut(lcfg, kCascDCABachToPV, lCascadeResult->GetCutDCABachToPV());
+        fCascadeCutEngine->SetCut(lcfg, kCascDCACascDaughters, (Float_t) lCascadeResult->GetCutDCACascDaughters());
+        fCascadeCutEngine->SetCut(lcfg, kCascCosPA, (Float_t) lCascadeResult->GetCutCascCosPA());
+        fCascadeCutEngine->SetCut(lcfg, kCascRadius,      lCascadeResult->GetCutCascRadius());
+        fCascadeCutEngine->SetCut(lcfg, kCascProperLifetime, lCascadeResult->GetCutProperLifetime());
+        fCascadeCutEngine->SetCut(lcfg, kCascLeastClusters, lCascadeResult->GetCutLeastNumberOfClusters());
+        fCascadeCutEngine->SetCut(lcfg, kCascNegdEdx,     lCascadeResult->GetCutTPCdEdx());
+        fCascadeCutEngine->SetCut(lcfg, kCascPosdEdx,     lCascadeResult->GetCutTPCdEdx());
+        fCascadeCutEngine->SetCut(lcfg, kCascBachdEdx,    lCascadeResult->GetCutTPCdEdx());
+        fCascadeCutEngine->SetCut(lcfg, kCascDCABachToBaryon, lCascadeResult->GetCutDCABachToBaryon());
+        fCascadeCutEngine->SetCut(lcfg, kCascMinV0Lifetime, lCascadeResult->GetCutMinV0Lifetime());
+    }
+    fCascadeCutEngine->Build();
+}
+
 //________________________________________________________________________
 void AliAnalysisTaskStrangenessVsMultiplicityRun2::SetupStandardVertexing()
 //Meant to store standard re-vertexing configuration
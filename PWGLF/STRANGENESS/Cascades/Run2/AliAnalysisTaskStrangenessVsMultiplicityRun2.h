@@ -43,6 +43,7 @@ class AliESDFMD;
 class AliCFContainer;
 class AliV0Result;
 class AliCascadeResult;
+class AliWeakResultCutEngine;
 
 //#include "TString.h"
 //#include "AliESDtrackCuts.h"
@@ -94,6 +95,11 @@ public:
     void SetExtraCleanup ( Bool_t lExtraCleanup = kTRUE) {
         fkExtraCleanup = lExtraCleanup;
     }
+    void SetUseCutEngine ( Bool_t lUseCutEngine = kTRUE) {
+        //Skip configurations failing the simple threshold cuts without
+        //evaluating them (see AliWeakResultCutEngine); same output
+        fkUseCutEngine = lUseCutEngine;
+    }
 //---------------------------------------------------------------------------------------
     void SetUseExtraEvSels ( Bool_t lUseExtraEvSels = kTRUE) {
         fkDoExtraEvSels = lUseExtraEvSels;
@@ -224,6 +230,10 @@ public:
 
 
 private:
+    //Fill the threshold cuts of the configurations in the cut engines
+    void BuildV0CutEngine();
+    void BuildCascadeCutEngine();
+
     // Note : In ROOT, "//!" means "do not stream the data from Master node to Worker node" ...
     // your data member object is created on the worker nodes and streaming is not needed.
     // http://root.cern.ch/download/doc/11InputOutput.pdf, page 14
@@ -266,6 +276,10 @@ private:
     Bool_t    fkUseLightVertexer;       // if true, use AliLightVertexers instead of regular ones
     Bool_t    fkDoV0Refit;              // if true, will invoke AliESDv0::Refit in the vertexing procedure
     Bool_t    fkExtraCleanup;           //if true, perform pre-rejection of useless candidates before going through configs
+    Bool_t    fkUseCutEngine;           //if true, pre-select configurations with AliWeakResultCutEngine
+
+    AliWeakResultCutEngine *fV0CutEngine;      //! threshold cuts of the V0 configurations
+    AliWeakResultCutEngine *fCascadeCutEngine; //! threshold cuts of the cascade configurations
 
     AliVEvent::EOfflineTriggerTypes fTrigType; // trigger type
 
@@ -507,8 +521,9 @@ private:
     AliAnalysisTaskStrangenessVsMultiplicityRun2(const AliAnalysisTaskStrangenessVsMultiplicityRun2&);            // not implemented
     AliAnalysisTaskStrangenessVsMultiplicityRun2& operator=(const AliAnalysisTaskStrangenessVsMultiplicityRun2&); // not implemented
 
-    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 2);
+    ClassDef(AliAnalysisTaskStrangenessVsMultiplicityRun2, 3);
     //1: first implementation
+    //3: configuration pre-selection with AliWeakResultCutEngine
 };
 
 #endif
@@ -0,0 +1,155 @@
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Helper to evaluate simple threshold cuts of many configurations
+// at once, see header file
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+#include "AliWeakResultCutEngine.h"
+#include "AliLog.h"
+#include <algorithm>
+#include <utility>
+
+ClassImp(AliWeakResultCutEngine);
+
+//________________________________________________________________
+AliWeakResultCutEngine::AliWeakResultCutEngine() :
+TObject(),
+fNConfigurations(0), fNVariables(0), fNWords(0), fNGroups(0),
+fIsUpperCut(), fCuts(), fGroups(), fSortedCuts(), fNSortedCuts(),
+fPrefixMasks(), fGroupMasks(), fSelection(), fWork()
+{
+    // Dummy Constructor - not to be used!
+}
+
+//________________________________________________________________
+AliWeakResultCutEngine::~AliWeakResultCutEngine()
+{
+    // Proper destructor: nothing to be deleted
+}
+
+//________________________________________________________________
+void AliWeakResultCutEngine::Init( Int_t lNConfigurations, Int_t lNVariables )
+{
+    //Reset the engine for a given number of configurations and variables
+    //All variables are lower cuts and all configurations in group 0 by default
+    fNConfigurations = lNConfigurations > 0 ? lNConfigurations : 0;
+    fNVariables      = lNVariables > 0 ? lNVariables : 0;
+    fNWords          = (fNConfigurations+63)/64;
+    fNGroups         = 0;
+
+    fIsUpperCut.assign( fNVariables, kFALSE );
+    fCuts.assign( fNConfigurations*fNVariables, 0. );
+    fGroups.assign( fNConfigurations, 0 );
+    fSortedCuts.clear();
+    fNSortedCuts.clear();
+    fPrefixMasks.clear();
+    fGroupMasks.clear();
+    fSelection.assign( fNWords, 0 );
+    fWork.assign( fNWords, 0 );
+}
+
+//________________________________________________________________
+void AliWeakResultCutEngine::SetUpperCut( Int_t lVariable, Bool_t lUpper )
+{
+    if( lVariable < 0 || lVariable >= fNVariables ) return;
+    fIsUpperCut[lVariable] = lUpper;
+}
+
+//________________________________________________________________
+void AliWeakResultCutEngine::SetCut( Int_t lConfiguration, Int_t lVariable, Double_t lCut )
+{
+    if( lConfiguration < 0 || lConfiguration >= fNConfigurations ) return;
+    if( lVariable < 0 || lVariable >= fNVariables ) return;
+    fCuts[lConfiguration*fNVariables+lVariable] = lCut;
+}
+
+//________________________________________________________________
+void AliWeakResultCutEngine::SetGroup( Int_t lConfiguration, Int_t lGroup )
+{
+    if( lConfiguration < 0 || lConfiguration >= fNConfigurations ) return;
+    fGroups[lConfiguration] = lGroup;
+}
+
+//________________________________________________________________
+void AliWeakResultCutEngine::Build()
+{
+    //Sort the thresholds of each variable and store the prefix masks
+    //Upper cuts (value < cut) are stored negated, so that every variable
+    //is evaluated as "value > cut"
+
+    //Group masks
+    fNGroups = 0;
+    for( Int_t icfg=0; icfg<fNConfigurations; icfg++)
+        if( fGroups[icfg]+1 > fNGroups ) fNGroups = fGroups[icfg]+1;
+    fGroupMasks.assign( fNGroups*fNWords, 0 );
+    for( Int_t icfg=0; icfg<fNConfigurations; icfg++){
+        if( fGroups[icfg] < 0 ) continue;
+        fGroupMasks[fGroups[icfg]*fNWords + (icfg>>6)] |= ( ULong64_t(1) << (icfg&63) );
+    }
+
+    //Sorted thresholds and prefix masks
+    fSortedCuts.assign( fNVariables*fNConfigurations, 0. );
+    fNSortedCuts.assign( fNVariables, 0 );
+    fPrefixMasks.assign( fNVariables*(fNConfigurations+1)*fNWords, 0 );
+
+    std::vector< std::pair<Double_t,Int_t> > lSorted;
+    lSorted.reserve( fNConfigurations );
+    for( Int_t ivar=0; ivar<fNVariables; ivar++){
+        lSorted.clear();
+        for( Int_t icfg=0; icfg<fNConfigurations; icfg++){
+            Double_t lCut = fCuts[icfg*fNVariables+ivar];
+            if( lCut != lCut ) continue; //NaN: comparison always fails
+            if( fIsUpperCut[ivar] ) lCut = -lCut;
+            lSorted.push_back( std::make_pair( lCut, icfg ) );
+        }
+        std::sort( lSorted.begin(), lSorted.end() );
+
+        Int_t lNSorted = lSorted.size();
+        fNSortedCuts[ivar] = lNSorted;
+        Double_t  *lCuts = &fSortedCuts[ivar*fNConfigurations];
+        ULong64_t *lMask = &fPrefixMasks[ivar*(fNConfigurations+1)*fNWords];
+        for( Int_t k=0; k<lNSorted; k++){
+            lCuts[k] = lSorted[k].first;
+            //configurations of the k+1 loosest thresholds
+            for( Int_t iw=0; iw<fNWords; iw++) lMask[(k+1)*fNWords+iw] = lMask[k*fNWords+iw];
+            Int_t icfg = lSorted[k].second;
+            lMask[(k+1)*fNWords+(icfg>>6)] |= ( ULong64_t(1) << (icfg&63) );
+        }
+    }
+    AliDebug(1, Form("%i configurations, %i variables, %i groups", fNConfigurations, fNVariables, fNGroups));
+}
+
+//________________________________________________________________
+void AliWeakResultCutEngine::ResetSelection()
+{
+    for( Int_t iw=0; iw<fNWords; iw++) fSelection[iw] = 0;
+}
+
+//________________________________________________________________
+void AliWeakResultCutEngine::Select( Int_t lGroup, const Double_t *lValues )
+{
+    //Add the configurations of group lGroup passing all the cuts for the
+    //given candidate values (one per variable) to the selection
+    if( lGroup < 0 || lGroup >= fNGroups || fNWords == 0 ) return;
+
+    ULong64_t *lWork = &fWork[0];
+    const ULong64_t *lGroupMask = &fGroupMasks[lGroup*fNWords];
+    for( Int_t iw=0; iw<fNWords; iw++) lWork[iw] = lGroupMask[iw];
+
+    for( Int_t ivar=0; ivar<fNVariables; ivar++){
+        Double_t lValue = fIsUpperCut[ivar] ? -lValues[ivar] : lValues[ivar];
+        //number of thresholds below the value (NaN: none)
+        Int_t lNPass = 0;
+        if( lValue == lValue ){
+            const Double_t *lCuts = &fSortedCuts[ivar*fNConfigurations];
+            lNPass = std::lower_bound( lCuts, lCuts+fNSortedCuts[ivar], lValue ) - lCuts;
+        }
+        const ULong64_t *lMask = &fPrefixMasks[(ivar*(fNConfigurations+1)+lNPass)*fNWords];
+        ULong64_t lAny = 0;
+        for( Int_t iw=0; iw<fNWords; iw++){
+            lWork[iw] &= lMask[iw];
+            lAny |= lWork[iw];
+        }
+        if( !lAny ) return;
+    }
+    for( Int_t iw=0; iw<fNWords; iw++) fSelection[iw] |= lWork[iw];
+}
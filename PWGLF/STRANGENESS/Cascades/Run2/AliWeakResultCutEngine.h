@@ -0,0 +1,74 @@
+#ifndef AliWeakResultCutEngine_H
+#define AliWeakResultCutEngine_H
+#include <TObject.h>
+#include <vector>
+
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+// Helper to evaluate simple threshold cuts of many configurations
+// (AliV0Result / AliCascadeResult) at once.
+//
+// Each configuration has one threshold per variable, either a lower
+// cut (value > cut) or an upper cut (value < cut). The thresholds of
+// every variable are sorted once, together with the set of
+// configurations owning the k loosest thresholds, so that for a given
+// candidate the configurations passing a variable are found with a
+// binary search, and all variables are combined with a few 64-bit
+// ANDs instead of evaluating every configuration. Configurations are
+// organised in groups (e.g. mass hypothesis); a group is only
+// evaluated with the values that apply to it.
+//
+// NaN thresholds never pass, NaN values pass no configuration, i.e.
+// the result is identical to the plain comparisons.
+//+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+
+class AliWeakResultCutEngine : public TObject {
+
+public:
+    //Simple constructor
+    AliWeakResultCutEngine();
+
+    //Simple destructor
+    ~AliWeakResultCutEngine();
+
+    //Setup: declare sizes, cuts and groups, then call Build()
+    void Init( Int_t lNConfigurations, Int_t lNVariables );
+    void SetUpperCut( Int_t lVariable, Bool_t lUpper = kTRUE );
+    void SetCut( Int_t lConfiguration, Int_t lVariable, Double_t lCut );
+    void SetGroup( Int_t lConfiguration, Int_t lGroup );
+    void Build();
+
+    Int_t GetNConfigurations() const { return fNConfigurations; }
+    Int_t GetNVariables     () const { return fNVariables;      }
+    Int_t GetNGroups        () const { return fNGroups;         }
+
+    //Per-candidate evaluation: ResetSelection(), then Select() for each
+    //applicable group (results are OR-ed), then query IsSelected()
+    void ResetSelection();
+    void Select( Int_t lGroup, const Double_t *lValues );
+    Bool_t IsSelected( Int_t lConfiguration ) const {
+        return ( fSelection[lConfiguration>>6] >> (lConfiguration&63) ) & 1;
+    }
+
+private:
+    AliWeakResultCutEngine(const AliWeakResultCutEngine&);            // not implemented
+    AliWeakResultCutEngine& operator=(const AliWeakResultCutEngine&); // not implemented
+
+    Int_t fNConfigurations; //number of configurations
+    Int_t fNVariables;      //number of variables
+    Int_t fNWords;          //number of 64-bit words per configuration mask
+    Int_t fNGroups;         //number of groups
+
+    std::vector<Bool_t>    fIsUpperCut;  //! per variable: value < cut (instead of value > cut)
+    std::vector<Double_t>  fCuts;        //! thresholds, [configuration*fNVariables+variable]
+    std::vector<Int_t>     fGroups;      //! group of each configuration (-1: never selected)
+    std::vector<Double_t>  fSortedCuts;  //! per variable, sorted non-NaN thresholds (negated for upper cuts)
+    std::vector<Int_t>     fNSortedCuts; //! per variable, number of sorted thresholds
+    std::vector<ULong64_t> fPrefixMasks; //! per variable and k, configurations with the k loosest thresholds
+    std::vector<ULong64_t> fGroupMasks;  //! per group, configurations in the group
+    std::vector<ULong64_t> fSelection;   //! selected configurations for the current candidate
+    std::vector<ULong64_t> fWork;        //! work mask
+
+    ClassDef(AliWeakResultCutEngine, 1)
+    // 1 - original implementation
+};
+#endif
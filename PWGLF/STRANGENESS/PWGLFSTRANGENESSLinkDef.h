@@ -47,6 +47,7 @@
 #pragma link C++ class AliVWeakResult+;
 #pragma link C++ class AliV0Result+;
 #pragma link C++ class AliCascadeResult+;
+#pragma link C++ class AliWeakResultCutEngine+;
 #pragma link C++ class AliStrangenessModule+;
 #pragma link C++ class AliAnalysisTaskWeakDecayVertexer+;
 #pragma link C++ class AliAnalysisTaskStrEffStudy+; 
@@ -87,6 +87,7 @@
 #include "AliPIDResponse.h"
 #include "TVectorD.h"
 #include "TStatToolkit.h"
+#include <algorithm>
 using namespace std;
 
 ClassImp(AliAnalysisTaskFilteredTree)
@@ -134,6 +135,10 @@ ClassImp(AliAnalysisTaskFilteredTree)
   , fPtResCentPtTPCITS(0)
   , fCurrentFileName("")
   , fDummyTrack(0)
+  , fNearestTrackEvent()
+  , fNearestTrackIndex()
+  , fNearestTrackNaN()
+  , fNearestTrackCandidates()
 {
   // Constructor
 
@@ -314,6 +319,8 @@ void AliAnalysisTaskFilteredTree::UserExec(Option_t *)
     Printf("ERROR: ESD event not available");
     return;
   }
+  // nearest track index to be rebuilt for the new event
+  for (Int_t i=0; i<6; i++) fNearestTrackEvent[i]=NULL;
   //if MC info available - use it.
   fMC = MCEvent();
   if (fMC){  
@@ -2912,14 +2919,33 @@ Int_t   AliAnalysisTaskFilteredTree::GetNearestTrack(const AliExternalTrackParam
     ::Error("AliAnalysisTaskFilteredTree::GetNearestTrack","invalid track pointer");
     return -1;
   }
-  Int_t ntracks=event->GetNumberOfTracks();
   const Double_t ktglCut=0.1;
   const Double_t kqptCut=0.4;
   const Double_t kAlphaCut=0.2;
   //
+  // candidates within the tgl window from the per event index (tracks with undefined tgl always pass the cut)
+  // the cuts below are applied as before, ties in chi2 are resolved in favour of the lowest track index
+  if (trackType<0 || trackType>2 || paramType<0 || paramType>1) return -1;
+  const Int_t iIndex=trackType*2+paramType;
+  if (fNearestTrackEvent[iIndex]!=event) BuildNearestTrackIndex(event,trackType,paramType);
+  const std::vector<std::pair<Double_t,Int_t> > &index=fNearestTrackIndex[iIndex];
+  const std::vector<Int_t> &indexNaN=fNearestTrackNaN[iIndex];
+  fNearestTrackCandidates.clear();
+  const Double_t tglMatch=trackMatch->GetTgl();
+  if (tglMatch==tglMatch){
+    const Double_t kMargin=1e-6;   // safety margin on the window, the exact cut is applied below
+    std::vector<std::pair<Double_t,Int_t> >::const_iterator it=std::lower_bound(index.begin(),index.end(),std::make_pair(tglMatch-ktglCut-kMargin,-1));
+    for (; it!=index.end() && it->first<=tglMatch+ktglCut+kMargin; ++it) fNearestTrackCandidates.push_back(it->second);
+  }else{
+    for (UInt_t i=0; i<index.size(); i++) fNearestTrackCandidates.push_back(index[i].second);
+  }
+  fNearestTrackCandidates.insert(fNearestTrackCandidates.end(),indexNaN.begin(),indexNaN.end());
+  //
   Double_t chi2Min=100000;
   Int_t indexMin=-1;
-  for (Int_t itrack=0; itrack<ntracks; itrack++){
+  const Int_t ncandidates=fNearestTrackCandidates.size();
+  for (Int_t icandidate=0; icandidate<ncandidates; icandidate++){
+    Int_t itrack=fNearestTrackCandidates[icandidate];
     if (itrack==indexSkip) continue;
     AliESDtrack *ptrack=event->GetTrack(itrack);
     if (ptrack==NULL) continue;
@@ -2949,7 +2975,7 @@ Int_t   AliAnalysisTaskFilteredTree::GetNearestTrack(const AliExternalTrackParam
     if (param.Rotate(trackMatch->GetAlpha())==kFALSE) continue;
     if (param.PropagateTo(trackMatch->GetX(),trackMatch->GetBz())==kFALSE) continue;
     Double_t chi2=trackMatch->GetPredictedChi2(&param);
-    if (chi2<chi2Min){
+    if (chi2<chi2Min || (chi2==chi2Min && itrack<indexMin)){
       indexMin=itrack;
       chi2Min=chi2;
       paramNearest=param;
@@ -2959,6 +2985,34 @@ Int_t   AliAnalysisTaskFilteredTree::GetNearestTrack(const AliExternalTrackParam
 
 }
 
+void AliAnalysisTaskFilteredTree::BuildNearestTrackIndex(AliESDEvent *event, Int_t trackType, Int_t paramType){
+  //
+  // Build the index of the GetNearestTrack candidates of the event for given trackType and paramType
+  // tracks passing the track type, kink and parameter selection, sorted in tgl
+  //
+  const Int_t iIndex=trackType*2+paramType;
+  std::vector<std::pair<Double_t,Int_t> > &index=fNearestTrackIndex[iIndex];
+  std::vector<Int_t> &indexNaN=fNearestTrackNaN[iIndex];
+  index.clear();
+  indexNaN.clear();
+  Int_t ntracks=event->GetNumberOfTracks();
+  for (Int_t itrack=0; itrack<ntracks; itrack++){
+    AliESDtrack *ptrack=event->GetTrack(itrack);
+    if (ptrack==NULL) continue;
+    if (trackType==0 && (ptrack->IsOn(0x1)==kFALSE || ptrack->IsOn(0x10)==kTRUE))  continue;
+    if (trackType==1 && (ptrack->IsOn(0x10)==kFALSE))   continue;
+    if (trackType==2 && (ptrack->IsOn(0x1)==kFALSE || ptrack->IsOn(0x10)==kFALSE)) continue;
+    if (ptrack->GetKinkIndex(0)<0) continue;
+    const AliExternalTrackParam * track=(paramType==0) ? ptrack:ptrack->GetInnerParam();
+    if (track==NULL) continue;
+    Double_t tgl=track->GetTgl();
+    if (tgl==tgl) index.push_back(std::make_pair(tgl,itrack));
+    else indexNaN.push_back(itrack);
+  }
+  std::sort(index.begin(),index.end());
+  fNearestTrackEvent[iIndex]=event;
+}
+
 
 void  AliAnalysisTaskFilteredTree::SetDefaultAliasesV0(TTree *tree){
   //
@@ -3193,11 +3247,29 @@ Int_t AliAnalysisTaskFilteredTree::GetMCTrackDiff(const TParticle &particle, con
   return 0;
 }
 
-/// # AliAnalysisTaskFilteredTree::GetMCInfoTrack - attach MC track info into map
+/// # AliAnalysisTaskFilteredTree::MCTrackInfo::Reset - clear the MC track info record
+void AliAnalysisTaskFilteredTree::MCTrackInfo::Reset(){
+  fParticle=NULL;
+  fRefDecay=NULL;
+  fESDTrack=NULL;
+  fITSTrack=NULL;
+  fNRef=0;
+  fLoopCounter=0;
+  fMaxRadius=0;
+  for (Int_t iDet=0; iDet<kNDet; iDet++) {
+    fRefCounter[iDet]=0;
+    fDetLength[iDet]=0;
+  }
+  for (Int_t iDiff=0; iDiff<kNDiffParams; iDiff++){
+    fHasDiff[iDiff]=kFALSE;
+    for (Int_t iPar=0; iPar<5; iPar++) fDiff[iDiff][iPar]=0;
+  }
+}
+
+/// # AliAnalysisTaskFilteredTree::GetMCInfoTrack - attach MC track info into record
 /// combine MC and reconstruction particle information and calculate derived information
 /// \param label        - track label
-/// \param trackInfoF   - std map with
-/// \param trackInfoO   - std map with object information, map is OWNER of all containing information (shared pointers can be used because of alice C++ limitation)
+/// \param trackInfo    - fixed layout record, reset at the beginning; pointers are not owned
 /// \return             - 0 OK - >0 error code
 ///
 /// ### Information collected
@@ -3205,11 +3277,12 @@ Int_t AliAnalysisTaskFilteredTree::GetMCTrackDiff(const TParticle &particle, con
 ///    * 2.) particle trajectory information (based on array o AliTrackReference)
 ///    * 3.) reconstruction information (based on the MC label information)
 ///    * 4.) diff between MC and real data at reference planes
-Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label,  std::map<std::string,float> &trackInfoF, std::map<std::string,TObject*> &trackInfoO){
+Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label, MCTrackInfo &trackInfo){
    // 0.)  define some constants
   const Double_t kTPCOutR=245; // used in loop counters
   AliStack * stack = fMC->Stack();
   Int_t mcStackSize=stack->GetNtrack();
+  trackInfo.Reset();
   if (label>mcStackSize){
     return 1;
   }
@@ -3217,13 +3290,13 @@ Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label,  std::map<std::st
   TParticle *particle=NULL;
   TClonesArray *trackRefs=0;
   Int_t status = fMC->GetParticleAndTR(label, particle, trackRefs);
-  trackInfoO["p"]=particle;    // particle information
+  trackInfo.fParticle=particle;    // particle information
   if (particle==NULL || particle->GetPDG() ==NULL || particle->GetPDG()->Charge()!=0.) {
     return 2;
   }
   // 2.) particle trajectory information
   Int_t nTrackRef = trackRefs->GetEntries();
-  trackInfoF["nRef"]=nTrackRef;  // number of references
+  trackInfo.fNRef=nTrackRef;  // number of references
   if (nTrackRef==0){
     return 4;
   }
@@ -3238,7 +3311,7 @@ Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label,  std::map<std::st
     if (ref->Label() != label) continue;
     Int_t detID=ref->DetectorId();
     if (detID < 0) {
-      trackInfoO["refDecay"] = ref;
+      trackInfo.fRefDecay = ref;
       break;
     }
     if (ref->R()>maxRadius) maxRadius=ref->R();
@@ -3258,10 +3331,12 @@ Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label,  std::map<std::st
       detRef[detID]=ref;
     }
   }
-  trackInfoO["refCounter"]=new TVectorF(refCounter);
-  trackInfoO["detLength"]=new TVectorF(detLength);
-  trackInfoF["loopCounter"]=loopCounter;
-  trackInfoF["maxRadius"]=maxRadius;
+  for (Int_t iDet=0; iDet<MCTrackInfo::kNDet; iDet++){
+    trackInfo.fRefCounter[iDet]=refCounter[iDet];
+    trackInfo.fDetLength[iDet]=detLength[iDet];
+  }
+  trackInfo.fLoopCounter=loopCounter;
+  trackInfo.fMaxRadius=maxRadius;
   // 3.) Assign - reconstruction information
   //     In case particle reconstructed more than once - use the best
   //     Distance definition ???
@@ -3306,40 +3381,27 @@ Int_t AliAnalysisTaskFilteredTree::GetMCInfoTrack(Int_t label,  std::map<std::st
       itsTrack = track;
     }
   }
-  trackInfoO["esdTrack"]=esdTrack;
-  trackInfoO["itsTrack"]=itsTrack;
+  trackInfo.fESDTrack=esdTrack;
+  trackInfo.fITSTrack=itsTrack;
   //4.) diff between MC and real data at reference planes
   TVectorF mcDiff(5);
   if (esdTrack!=NULL){
-    if (GetMCTrackDiff(*particle,*(esdTrack), *trackRefs, mcDiff)==0){
-        trackInfoO["diffesdTrack"]=new TVectorF(mcDiff);
-    };
-    if (esdTrack->GetTPCInnerParam()){
-      if (GetMCTrackDiff(*particle,*(esdTrack->GetTPCInnerParam()), *trackRefs, mcDiff)==0){
-        trackInfoO["diffTPCInnerParam"]=new TVectorF(mcDiff);
-      };
-    }
-    if (esdTrack->GetInnerParam()){
-      if (GetMCTrackDiff(*particle,*(esdTrack->GetInnerParam()), *trackRefs, mcDiff)==0){
-        trackInfoO["diffInnerParam"]=new TVectorF(mcDiff);
-      };
-    }
-    if (esdTrack->GetOuterParam()){
-      if (GetMCTrackDiff(*particle,*(esdTrack->GetOuterParam()), *trackRefs, mcDiff)==0){
-        trackInfoO["diffOuterParam"]=new TVectorF(mcDiff);
-      };
-    }
-    if (esdTrack->GetOuterHmpParam()){
-      if (GetMCTrackDiff(*particle,*(esdTrack->GetOuterHmpParam()), *trackRefs, mcDiff)==0){
-        trackInfoO["diffOuterHmpParam"]=new TVectorF(mcDiff);
-      };
+    const AliExternalTrackParam *diffParam[MCTrackInfo::kNDiffParams]={esdTrack, esdTrack->GetTPCInnerParam(), esdTrack->GetInnerParam(), esdTrack->GetOuterParam(), esdTrack->GetOuterHmpParam()};
+    for (Int_t iDiff=0; iDiff<MCTrackInfo::kNDiffParams; iDiff++){
+      if (diffParam[iDiff]==NULL) continue;
+      if (GetMCTrackDiff(*particle,*(diffParam[iDiff]), *trackRefs, mcDiff)==0){
+        trackInfo.fHasDiff[iDiff]=kTRUE;
+        for (Int_t iPar=0; iPar<5; iPar++) trackInfo.fDiff[iDiff][iPar]=mcDiff[iPar];
+      }
     }
   }
   return 0;
 }
 
-Int_t AliAnalysisTaskFilteredTree::GetMCInfoKink(Int_t label, std::map<std::string,float> &kinkInfoF, std::map<std::string,TObject*> &kinkInfoO){
-
+Int_t AliAnalysisTaskFilteredTree::GetMCInfoKink(Int_t /*label*/, MCTrackInfo &kinkInfo){
+  // kink MC information not implemented - the record is cleared and a non zero status returned
+  kinkInfo.Reset();
+  return 1;
 }
 
 /// ProcessMC() information
@@ -3350,8 +3412,7 @@ void AliAnalysisTaskFilteredTree::ProcessMC(){
   AliStack * stack = fMC->Stack();
   if (!stack) return;
   Int_t mcStackSize=stack->GetNtrack();
-  std::map<std::string,float> trackInfoF;
-  std::map<std::string,TObject*> trackInfoO;
+  MCTrackInfo trackInfo;
   static Int_t downscaleCounter=0;
   for (Int_t iMc = 0; iMc < mcStackSize; ++iMc) {
     TParticle *particle = stack->Particle(iMc);
@@ -3361,7 +3422,7 @@ void AliAnalysisTaskFilteredTree::ProcessMC(){
     Double_t downscaleF = gRandom->Rndm();
     downscaleF *= fLowPtTrackDownscaligF;
     if (downscaleCounter>0 && TMath::Exp(2*scalempt)<downscaleF) continue;
-    Int_t result = GetMCInfoTrack(iMc, trackInfoF,trackInfoO);
+    Int_t result = GetMCInfoTrack(iMc, trackInfo);
 
   }
 }
\ No newline at end of file
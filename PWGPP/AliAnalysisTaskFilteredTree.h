@@ -29,8 +29,11 @@ class TObjArray;
 class TTree;
 class TTreeSRedirector;
 class TParticle;
+class AliTrackReference;
 class TH3D;
 #include <string>
+#include <vector>
+#include <utility>
 
 #include "AliTriggerAnalysis.h"
 #include "AliAnalysisTaskSE.h"
@@ -42,6 +45,26 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
                       kTPCITSAnalysisMode=0,
                       kTPCAnalysisMode=1 };
 
+  //
+  // MC and reconstruction information of one particle, filled by GetMCInfoTrack
+  //
+  struct MCTrackInfo {
+    enum { kNDet=21 };                 // number of detector IDs of the track references
+    enum EDiffParam { kDiffESDTrack=0, kDiffTPCInnerParam, kDiffInnerParam, kDiffOuterParam, kDiffOuterHmpParam, kNDiffParams };
+    TParticle *fParticle;              // particle
+    AliTrackReference *fRefDecay;      // track reference of the decay (NULL if none)
+    AliESDtrack *fESDTrack;            // best reconstructed track
+    AliESDtrack *fITSTrack;            // ITS standalone track
+    Int_t   fNRef;                     // number of track references
+    Int_t   fLoopCounter;              // turning point counter (loopers)
+    Float_t fMaxRadius;                // maximal radius of the track references
+    Float_t fRefCounter[kNDet];        // number of references per detector
+    Float_t fDetLength[kNDet];         // distance between the first and the last reference per detector
+    Bool_t  fHasDiff[kNDiffParams];    // MC - reconstruction difference available
+    Float_t fDiff[kNDiffParams][5];    // MC - reconstruction parameter difference at the reference planes
+    void Reset();
+  };
+
   AliAnalysisTaskFilteredTree(const char *name = "AliAnalysisTaskFilteredTree");
   virtual ~AliAnalysisTaskFilteredTree();
   
@@ -119,8 +142,8 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   Int_t   GetNearestTrack(const AliExternalTrackParam * trackMatch, Int_t indexSkip, AliESDEvent*event, Int_t trackType, Int_t paramType,  AliExternalTrackParam & paramNearest);
   static void SetDefaultAliasesV0(TTree *treeV0);
   static void SetDefaultAliasesHighPt(TTree *treeV0);
-  Int_t GetMCInfoTrack(Int_t label,   std::map<std::string,float> &trackInfoF, std::map<std::string,TObject*> &trackInfoO);  //TODO- test before enabling
-  Int_t GetMCInfoKink(Int_t label,    std::map<std::string,float> &kinkInfoF, std::map<std::string,TObject*> &kinkInfoO);  // TODO
+  Int_t GetMCInfoTrack(Int_t label, MCTrackInfo &trackInfo);  //TODO- test before enabling
+  Int_t GetMCInfoKink(Int_t label, MCTrackInfo &kinkInfo);    // not implemented, returns 1
   static Int_t GetMCTrackDiff(const TParticle &particle, const AliExternalTrackParam &param, TClonesArray &trackRefArray, TVectorF &mcDiff); //TODO test before enabling
  private:
 
@@ -174,10 +197,18 @@ class AliAnalysisTaskFilteredTree : public AliAnalysisTaskSE {
   TH3D* fPtResCentPtTPCITS; //! sigma(pt)/pt vs Cent vs Pt for prim. TPC+ITS tracks
   TObjString fCurrentFileName; // cached value of current file name
   AliESDtrack* fDummyTrack; //! dummy track for tree init
+  //
+  // per event index of the GetNearestTrack candidates, per trackType (0-2) and paramType (0-1)
+  AliESDEvent* fNearestTrackEvent[6];                                 //! event the index was built for (NULL - to be rebuilt)
+  std::vector<std::pair<Double_t,Int_t> > fNearestTrackIndex[6];     //! candidates sorted in tgl (tgl, track index)
+  std::vector<Int_t> fNearestTrackNaN[6];                            //! candidates with undefined tgl
+  std::vector<Int_t> fNearestTrackCandidates;                        //! candidates of the current search
+
+  void BuildNearestTrackIndex(AliESDEvent *event, Int_t trackType, Int_t paramType);
 
   AliAnalysisTaskFilteredTree(const AliAnalysisTaskFilteredTree&); // not implemented
   AliAnalysisTaskFilteredTree& operator=(const AliAnalysisTaskFilteredTree&); // not implemented
-  ClassDef(AliAnalysisTaskFilteredTree, 1); // example of analysis
+  ClassDef(AliAnalysisTaskFilteredTree, 2); // example of analysis
 };
 
 #endif
@@ -0,0 +1,77 @@
+/**************************************************************************************************
+ *                                                                                                *
+ * Package:       FlowVectorCorrections                                                           *
+ * Authors:       Jaap Onderwaater, GSI, jacobus.onderwaater@cern.ch                              *
+ *                Ilya Selyuzhenkov, GSI, ilya.selyuzhenkov@gmail.com                             *
+ *                Víctor González, UCM, victor.gonzalez@cern.ch                                   *
+ *                Contributors are mentioned in the code where appropriate.                       *
+ * Development:   2012-2016                                                                       *
+ *                                                                                                *
+ * This file is part of FlowVectorCorrections, a software package that corrects Q-vector          *
+ * measurements for effects of nonuniform detector acceptance. The corrections in this package    *
+ * are based on publication:                                                                      *
+ *                                                                                                *
+ *  [1] "Effects of non-uniform acceptance in anisotropic flow measurements"                      *
+ *  Ilya Selyuzhenkov and Sergei Voloshin                                                         *
+ *  Phys. Rev. C 77, 034904 (2008)                                                                *
+ *                                                                                                *
+ * The procedure proposed in [1] is extended with the following steps:                            *
+ * (*) alignment correction between subevents                                                     *
+ * (*) possibility to extract the twist and rescaling corrections                                 *
+ *      for the case of three detector subevents                                                  *
+ *      (currently limited to the case of two “hit-only” and one “tracking” detectors)            *
+ * (*) (optional) channel equalization                                                            *
+ * (*) flow vector width equalization                                                             *
+ *                                                                                                *
+ * FlowVectorCorrections is distributed under the terms of the GNU General Public License (GPL)   *
+ * (https://en.wikipedia.org/wiki/GNU_General_Public_License)                                     *
+ * either version 3 of the License, or (at your option) any later version.                        *
+ *                                                                                                *
+ **************************************************************************************************/
+
+/// \file AliQnCorrectionsDataVectorBank.cxx
+/// \brief Implementation of the data vector bank class
+
+#include "AliQnCorrectionsDataVectorBank.h"
+
+/// \cond CLASSIMP
+ClassImp(AliQnCorrectionsDataVectorBank);
+/// \endcond
+
+/// Default constructor
+AliQnCorrectionsDataVectorBank::AliQnCorrectionsDataVectorBank() : TObject(),
+    fN(0),
+    fId(),
+    fPhi(),
+    fWeight(),
+    fEqualizedWeight() {
+
+}
+
+/// Normal constructor
+/// Allocates the storage for the passed number of data vectors
+/// \param size the initial capacity of the bank
+AliQnCorrectionsDataVectorBank::AliQnCorrectionsDataVectorBank(Int_t size) : TObject(),
+    fN(0),
+    fId(size),
+    fPhi(size),
+    fWeight(size),
+    fEqualizedWeight(size) {
+
+}
+
+/// Default destructor
+AliQnCorrectionsDataVectorBank::~AliQnCorrectionsDataVectorBank() {
+
+}
+
+/// Enlarges the bank storage
+///
+/// The capacity is doubled keeping the current content.
+void AliQnCorrectionsDataVectorBank::Expand() {
+  Int_t size = ((fId.GetSize() > 0) ? 2 * fId.GetSize() : 1024);
+  fId.Set(size);
+  fPhi.Set(size);
+  fWeight.Set(size);
+  fEqualizedWeight.Set(size);
+}
@@ -0,0 +1,118 @@
+#ifndef ALIQNCORRECTIONS_DATAVECTORBANK_H
+#define ALIQNCORRECTIONS_DATAVECTORBANK_H
+
+/***************************************************************************
+ * Package:       FlowVectorCorrections                                    *
+ * Authors:       Jaap Onderwaater, GSI, jacobus.onderwaater@cern.ch       *
+ *                Ilya Selyuzhenkov, GSI, ilya.selyuzhenkov@gmail.com      *
+ *                Víctor González, UCM, victor.gonzalez@cern.ch            *
+ *                Contributors are mentioned in the code where appropriate.*
+ * Development:   2012-2016                                                *
+ * See cxx source for GPL licence et. al.                                  *
+ ***************************************************************************/
+
+/// \file AliQnCorrectionsDataVectorBank.h
+/// \brief Class that stores the data vectors of a detector configuration within the Q vector correction framework
+///
+/// The data vectors of the current event are stored in contiguous
+/// arrays, one per data vector member, instead of as one object per
+/// data vector. The storage is kept from event to event so, once
+/// the bank has grown to the event multiplicity, no allocation
+/// is done while collecting the data vectors.
+
+#include <TObject.h>
+#include <TArrayI.h>
+#include <TArrayF.h>
+
+/// \class AliQnCorrectionsDataVectorBank
+/// \brief Class that stores the data vectors of the current event
+///
+/// Each data vector is the channel id, the azimuthal angle, the raw weight
+/// and the equalized weight, which is initialized to the raw weight.
+/// Channelized detector configurations use the equalized weight for
+/// building the Q vectors while track detector configurations
+/// use the raw weight.
+class AliQnCorrectionsDataVectorBank : public TObject {
+public:
+  AliQnCorrectionsDataVectorBank();
+  AliQnCorrectionsDataVectorBank(Int_t size);
+  virtual ~AliQnCorrectionsDataVectorBank();
+
+  void Add(Int_t id, Float_t phi, Float_t weight);
+  /// Cleans the bank for the next event
+  /// The storage is kept
+  virtual void Clear(Option_t * = "") { fN = 0; }
+
+  /// Gets the number of stored data vectors
+  /// \return the number of data vectors
+  Int_t GetN() const { return fN; }
+  /// Gets the channel id associated with a data vector
+  /// \param i the data vector index
+  /// \return the channel id
+  Int_t GetId(Int_t i) const { return fId.fArray[i]; }
+  /// Gets the azimuthal angle of a data vector
+  /// \param i the data vector index
+  /// \return phi
+  Float_t Phi(Int_t i) const { return fPhi.fArray[i]; }
+  /// Gets the raw weight of a data vector
+  /// \param i the data vector index
+  /// \return the raw weight
+  Float_t Weight(Int_t i) const { return fWeight.fArray[i]; }
+  /// Gets the equalized weight of a data vector
+  /// \param i the data vector index
+  /// \return the equalized weight
+  Float_t EqualizedWeight(Int_t i) const { return fEqualizedWeight.fArray[i]; }
+  /// Sets the equalized weight of a data vector
+  /// \param i the data vector index
+  /// \param weight equalized weight after channel equalization
+  void SetEqualizedWeight(Int_t i, Float_t weight) { fEqualizedWeight.fArray[i] = weight; }
+
+  /// Gets the channel ids of the stored data vectors
+  /// \return pointer to the first channel id
+  const Int_t *GetIds() const { return fId.GetArray(); }
+  /// Gets the azimuthal angles of the stored data vectors
+  /// \return pointer to the first azimuthal angle
+  const Float_t *GetPhis() const { return fPhi.GetArray(); }
+  /// Gets the raw weights of the stored data vectors
+  /// \return pointer to the first raw weight
+  const Float_t *GetWeights() const { return fWeight.GetArray(); }
+  /// Gets the equalized weights of the stored data vectors
+  /// \return pointer to the first equalized weight
+  Float_t *GetEqualizedWeights() { return fEqualizedWeight.GetArray(); }
+
+private:
+  void Expand();
+
+  Int_t   fN;                     //!<! number of data vectors in the bank
+  TArrayI fId;                    //!<! the id associated with each data vector
+  TArrayF fPhi;                   //!<! the azimuthal angle of each data vector
+  TArrayF fWeight;                //!<! raw weight assigned to each data vector
+  TArrayF fEqualizedWeight;       //!<! equalized weight of each data vector
+
+  /// Copy constructor
+  /// Not allowed. Forced private.
+  AliQnCorrectionsDataVectorBank(const AliQnCorrectionsDataVectorBank &);
+  /// Assignment operator
+  /// Not allowed. Forced private.
+  AliQnCorrectionsDataVectorBank& operator= (const AliQnCorrectionsDataVectorBank &);
+
+/// \cond CLASSIMP
+  ClassDef(AliQnCorrectionsDataVectorBank, 1);
+/// \endcond
+};
+
+/// Stores a new data vector
+/// The equalized weight is initialized to the raw weight
+/// \param id the id associated with the data vector
+/// \param phi the azimuthal angle
+/// \param weight the data vector weight
+inline void AliQnCorrectionsDataVectorBank::Add(Int_t id, Float_t phi, Float_t weight) {
+  if (!(fN < fId.GetSize())) Expand();
+  fId.fArray[fN] = id;
+  fPhi.fArray[fN] = phi;
+  fWeight.fArray[fN] = weight;
+  fEqualizedWeight.fArray[fN] = weight;
+  fN++;
+}
+
+#endif /* ALIQNCORRECTIONS_DATAVECTORBANK_H */
@@ -21,6 +21,7 @@
 #include <TClonesArray.h>
 #include <TH3.h>
 #include "AliQnCorrectionsCutsSet.h"
+#include "AliQnCorrectionsDataVectorBank.h"
 #include "AliQnCorrectionsCorrectionsSetOnInputData.h"
 #include "AliQnCorrectionsCorrectionsSetOnQvector.h"
 #include "AliQnCorrectionsEventClassVariablesSet.h"
@@ -97,7 +98,7 @@ public:
   /// Get the input data bank.
   /// Makes it available for input corrections steps.
   /// \return pointer to the input data bank
-  TClonesArray *GetInputDataBank()
+  AliQnCorrectionsDataVectorBank *GetInputDataBank()
   { return fDataVectorBank; }
   /// Get the event class variables set
   /// Makes it available for corrections steps
@@ -272,7 +273,7 @@ protected:
   AliQnCorrectionsCutsSet *fCuts;         //->
 /// The default initial size of data vectors banks
 #define INITIALDATAVECTORBANKSIZE 100000
-  TClonesArray *fDataVectorBank;        //!<! input data for the current process / event
+  AliQnCorrectionsDataVectorBank *fDataVectorBank; //!<! input data for the current process / event
   AliQnCorrectionsQnVector fPlainQnVector;     ///< Qn vector from the post processed input data
   AliQnCorrectionsQnVector fPlainQ2nVector;     ///< Q2n vector from the post processed input data
   AliQnCorrectionsQnVector fCorrectedQnVector; ///< Qn vector after subsequent correction steps
@@ -293,7 +294,7 @@ private:
   AliQnCorrectionsDetectorConfigurationBase& operator= (const AliQnCorrectionsDetectorConfigurationBase &);
 
 /// \cond CLASSIMP
-  ClassDef(AliQnCorrectionsDetectorConfigurationBase, 3);
+  ClassDef(AliQnCorrectionsDetectorConfigurationBase, 4);
 /// \endcond
 };
 
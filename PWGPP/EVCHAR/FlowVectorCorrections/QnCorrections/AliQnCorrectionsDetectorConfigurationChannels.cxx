@@ -189,7 +189,7 @@ void AliQnCorrectionsDetectorConfigurationChannels::AttachCorrectionsManager(Ali
 void AliQnCorrectionsDetectorConfigurationChannels::CreateSupportDataStructures() {
 
   /* this is executed in the remote node so, allocate the data bank */
-  fDataVectorBank = new TClonesArray("AliQnCorrectionsDataVectorChannelized", INITIALDATAVECTORBANKSIZE);
+  fDataVectorBank = new AliQnCorrectionsDataVectorBank(INITIALDATAVECTORBANKSIZE);
 
   for (Int_t ixCorrection = 0; ixCorrection < fInputDataCorrections.GetEntries(); ixCorrection++) {
     fInputDataCorrections.At(ixCorrection)->CreateSupportDataStructures();
@@ -447,11 +447,9 @@ void AliQnCorrectionsDetectorConfigurationChannels::AddCorrectionOnInputData(Ali
 /// \param variableContainer pointer to the variable content bank
 void AliQnCorrectionsDetectorConfigurationChannels::FillQAHistograms(const Float_t *variableContainer) {
   if (fQAMultiplicityBefore3D != NULL && fQAMultiplicityAfter3D != NULL) {
-    for(Int_t ixData = 0; ixData < fDataVectorBank->GetEntriesFast(); ixData++){
-      AliQnCorrectionsDataVectorChannelized *dataVector =
-          static_cast<AliQnCorrectionsDataVectorChannelized *>(fDataVectorBank->At(ixData));
-      fQAMultiplicityBefore3D->Fill(variableContainer[fQACentralityVarId], fChannelMap[dataVector->GetId()], dataVector->Weight());
-      fQAMultiplicityAfter3D->Fill(variableContainer[fQACentralityVarId], fChannelMap[dataVector->GetId()], dataVector->EqualizedWeight());
+    for(Int_t ixData = 0; ixData < fDataVectorBank->GetN(); ixData++){
+      fQAMultiplicityBefore3D->Fill(variableContainer[fQACentralityVarId], fChannelMap[fDataVectorBank->GetId(ixData)], fDataVectorBank->Weight(ixData));
+      fQAMultiplicityAfter3D->Fill(variableContainer[fQACentralityVarId], fChannelMap[fDataVectorBank->GetId(ixData)], fDataVectorBank->EqualizedWeight(ixData));
     }
   }
   if (fQAQnAverageHistogram != NULL) {
@@ -156,7 +156,7 @@ private:
   AliQnCorrectionsDetectorConfigurationChannels& operator= (const AliQnCorrectionsDetectorConfigurationChannels &);
 
 /// \cond CLASSIMP
-  ClassDef(AliQnCorrectionsDetectorConfigurationChannels, 2);
+  ClassDef(AliQnCorrectionsDetectorConfigurationChannels, 3);
 /// \endcond
 };
 
@@ -174,8 +174,7 @@ inline Bool_t AliQnCorrectionsDetectorConfigurationChannels::AddDataVector(
     const Float_t *variableContainer, Double_t phi, Double_t weight, Int_t channelId) {
   if (IsSelected(variableContainer, channelId)) {
     /// add the data vector to the bank
-    new (fDataVectorBank->ConstructedAt(fDataVectorBank->GetEntriesFast()))
-      AliQnCorrectionsDataVectorChannelized(channelId, phi, weight);
+    fDataVectorBank->Add(channelId, phi, weight);
     return kTRUE;
   }
   return kFALSE;
@@ -188,10 +187,7 @@ inline Bool_t AliQnCorrectionsDetectorConfigurationChannels::AddDataVector(
 inline void AliQnCorrectionsDetectorConfigurationChannels::BuildRawQnVector() {
   fTempQnVector.Reset();
 
-  for(Int_t ixData = 0; ixData < fDataVectorBank->GetEntriesFast(); ixData++){
-    AliQnCorrectionsDataVectorChannelized *dataVector = static_cast<AliQnCorrectionsDataVectorChannelized *>(fDataVectorBank->At(ixData));
-    fTempQnVector.Add(dataVector->Phi(), dataVector->Weight());
-  }
+  fTempQnVector.Add(fDataVectorBank->GetPhis(), fDataVectorBank->GetWeights(), fDataVectorBank->GetN());
   fTempQnVector.CheckQuality();
   fTempQnVector.Normalize(fQnNormalizationMethod);
   fRawQnVector.Set(&fTempQnVector, kFALSE);
@@ -205,11 +201,8 @@ inline void AliQnCorrectionsDetectorConfigurationChannels::BuildQnVector() {
   fTempQnVector.Reset();
   fTempQ2nVector.Reset();
 
-  for(Int_t ixData = 0; ixData < fDataVectorBank->GetEntriesFast(); ixData++){
-    AliQnCorrectionsDataVectorChannelized *dataVector = static_cast<AliQnCorrectionsDataVectorChannelized *>(fDataVectorBank->At(ixData));
-    fTempQnVector.Add(dataVector->Phi(), dataVector->EqualizedWeight());
-    fTempQ2nVector.Add(dataVector->Phi(), dataVector->EqualizedWeight());
-  }
+  fTempQnVector.Add(fDataVectorBank->GetPhis(), fDataVectorBank->GetEqualizedWeights(), fDataVectorBank->GetN());
+  fTempQ2nVector.Add(fDataVectorBank->GetPhis(), fDataVectorBank->GetEqualizedWeights(), fDataVectorBank->GetN());
   fTempQnVector.CheckQuality();
   fTempQ2nVector.CheckQuality();
   fTempQnVector.Normalize(fQnNormalizationMethod);
@@ -307,7 +300,7 @@ inline void AliQnCorrectionsDetectorConfigurationChannels::ClearConfiguration()
   fCorrectedQnVector.Reset();
   fCorrectedQ2nVector.Reset();
   /* and now clear the the input data bank */
-  fDataVectorBank->Clear("C");
+  fDataVectorBank->Clear();
 }
 
 #endif // ALIQNCORRECTIONS_DETECTORCONFCHANNEL_H
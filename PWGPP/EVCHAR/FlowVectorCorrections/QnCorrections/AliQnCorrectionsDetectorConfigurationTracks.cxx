@@ -92,7 +92,7 @@ void AliQnCorrectionsDetectorConfigurationTracks::AttachCorrectionsManager(AliQn
 void AliQnCorrectionsDetectorConfigurationTracks::CreateSupportDataStructures() {
 
   /* this is executed in the remote node so, allocate the data bank */
-  fDataVectorBank = new TClonesArray("AliQnCorrectionsDataVector", INITIALDATAVECTORBANKSIZE);
+  fDataVectorBank = new AliQnCorrectionsDataVectorBank(INITIALDATAVECTORBANKSIZE);
 
   for (Int_t ixCorrection = 0; ixCorrection < fQnVectorCorrections.GetEntries(); ixCorrection++) {
     fQnVectorCorrections.At(ixCorrection)->CreateSupportDataStructures();
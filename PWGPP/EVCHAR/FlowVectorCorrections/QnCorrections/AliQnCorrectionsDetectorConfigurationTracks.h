@@ -88,7 +88,7 @@ private:
   AliQnCorrectionsProfileComponents *fQAQnAverageHistogram; //!<! the plain average Qn components QA histogram
 
 /// \cond CLASSIMP
-  ClassDef(AliQnCorrectionsDetectorConfigurationTracks, 2);
+  ClassDef(AliQnCorrectionsDetectorConfigurationTracks, 3);
 /// \endcond
 };
 
@@ -104,8 +104,7 @@ inline Bool_t AliQnCorrectionsDetectorConfigurationTracks::AddDataVector(
     const Float_t *variableContainer, Double_t phi, Double_t weight, Int_t id) {
   if (IsSelected(variableContainer)) {
     /// add the data vector to the bank
-    new (fDataVectorBank->ConstructedAt(fDataVectorBank->GetEntriesFast()))
-        AliQnCorrectionsDataVector(id, phi, weight);
+    fDataVectorBank->Add(id, phi, weight);
     return kTRUE;
   }
   return kFALSE;
@@ -127,7 +126,7 @@ inline void AliQnCorrectionsDetectorConfigurationTracks::ClearConfiguration() {
   fCorrectedQnVector.Reset();
   fCorrectedQ2nVector.Reset();
   /* and now clear the the input data bank */
-  fDataVectorBank->Clear("C");
+  fDataVectorBank->Clear();
 }
 
 /// Builds Qn vectors before Q vector corrections but
@@ -139,11 +138,8 @@ inline void AliQnCorrectionsDetectorConfigurationTracks::BuildQnVector() {
   fTempQnVector.Reset();
   fTempQ2nVector.Reset();
 
-  for(Int_t ixData = 0; ixData < fDataVectorBank->GetEntriesFast(); ixData++){
-    AliQnCorrectionsDataVector *dataVector = static_cast<AliQnCorrectionsDataVector *>(fDataVectorBank->At(ixData));
-    fTempQnVector.Add(dataVector->Phi(), dataVector->Weight());
-    fTempQ2nVector.Add(dataVector->Phi(), dataVector->Weight());
-  }
+  fTempQnVector.Add(fDataVectorBank->GetPhis(), fDataVectorBank->GetWeights(), fDataVectorBank->GetN());
+  fTempQ2nVector.Add(fDataVectorBank->GetPhis(), fDataVectorBank->GetWeights(), fDataVectorBank->GetN());
   /* check the quality of the Qn vector */
   fTempQnVector.CheckQuality();
   fTempQ2nVector.CheckQuality();
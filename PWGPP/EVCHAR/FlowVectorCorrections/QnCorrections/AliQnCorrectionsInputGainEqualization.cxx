@@ -210,104 +210,93 @@ Bool_t AliQnCorrectionsInputGainEqualization::CreateNveQAHistograms(TList *list)
 /// structures should be included.
 /// \return kTRUE if the correction step was applied
 Bool_t AliQnCorrectionsInputGainEqualization::ProcessCorrections(const Float_t *variableContainer) {
+  AliQnCorrectionsDataVectorBank *dataBank = fDetectorConfiguration->GetInputDataBank();
+  const Int_t nData = dataBank->GetN();
+  const Int_t *ids = dataBank->GetIds();
+  Float_t *weights = dataBank->GetEqualizedWeights();
+
   switch (fState) {
   case QCORRSTEP_calibration:
     /* collect the data needed to further produce equalization parameters */
-    for(Int_t ixData = 0; ixData < fDetectorConfiguration->GetInputDataBank()->GetEntriesFast(); ixData++){
-      AliQnCorrectionsDataVectorChannelized *dataVector =
-          static_cast<AliQnCorrectionsDataVectorChannelized *>(fDetectorConfiguration->GetInputDataBank()->At(ixData));
-      fCalibrationHistograms->Fill(variableContainer, dataVector->GetId(), dataVector->EqualizedWeight());
+    for(Int_t ixData = 0; ixData < nData; ixData++){
+      fCalibrationHistograms->Fill(variableContainer, ids[ixData], weights[ixData]);
     }
     return kFALSE;
     break;
   case QCORRSTEP_applyCollect:
     /* collect the data needed to further produce equalization parameters */
-    for(Int_t ixData = 0; ixData < fDetectorConfiguration->GetInputDataBank()->GetEntriesFast(); ixData++){
-      AliQnCorrectionsDataVectorChannelized *dataVector =
-          static_cast<AliQnCorrectionsDataVectorChannelized *>(fDetectorConfiguration->GetInputDataBank()->At(ixData));
-      fCalibrationHistograms->Fill(variableContainer, dataVector->GetId(), dataVector->EqualizedWeight());
+    for(Int_t ixData = 0; ixData < nData; ixData++){
+      fCalibrationHistograms->Fill(variableContainer, ids[ixData], weights[ixData]);
     }
     /* and proceed to ... */
   case QCORRSTEP_apply: /* apply the equalization */
     /* collect QA data if asked */
     if (fQAMultiplicityBefore != NULL) {
-      for(Int_t ixData = 0; ixData < fDetectorConfiguration->GetInputDataBank()->GetEntriesFast(); ixData++){
-        AliQnCorrectionsDataVectorChannelized *dataVector =
-            static_cast<AliQnCorrectionsDataVectorChannelized *>(fDetectorConfiguration->GetInputDataBank()->At(ixData));
-        fQAMultiplicityBefore->Fill(variableContainer, dataVector->GetId(), dataVector->EqualizedWeight());
+      for(Int_t ixData = 0; ixData < nData; ixData++){
+        fQAMultiplicityBefore->Fill(variableContainer, ids[ixData], weights[ixData]);
       }
     }
     /* store the equalized weights in the data vector bank according to equalization method */
     switch (fEqualizationMethod) {
     case GEQUAL_noEqualization:
-      for(Int_t ixData = 0; ixData < fDetectorConfiguration->GetInputDataBank()->GetEntriesFast(); ixData++){
-        AliQnCorrectionsDataVectorChannelized *dataVector =
-            static_cast<AliQnCorrectionsDataVectorChannelized *>(fDetectorConfiguration->GetInputDataBank()->At(ixData));
-        dataVector->SetEqualizedWeight(dataVector->EqualizedWeight());
-      }
+      /* the equalized weights are kept */
       break;
     case GEQUAL_averageEqualization:
-      for(Int_t ixData = 0; ixData < fDetectorConfiguration->GetInputDataBank()->GetEntriesFast(); ixData++){
-        AliQnCorrectionsDataVectorChannelized *dataVector =
-            static_cast<AliQnCorrectionsDataVectorChannelized *>(fDetectorConfiguration->GetInputDataBank()->At(ixData));
-        Long64_t bin = fInputHistograms->GetBin(variableContainer, dataVector->GetId());
+      for(Int_t ixData = 0; ixData < nData; ixData++){
+        Long64_t bin = fInputHistograms->GetBin(variableContainer, ids[ixData]);
         if (fInputHistograms->BinContentValidated(bin)) {
           Float_t average = fInputHistograms->GetBinContent(bin);
           /* let's handle the potential group weights usage */
           Float_t groupweight = 1.0;
           if (fUseChannelGroupsWeights) {
-            groupweight = fInputHistograms->GetGrpBinContent(fInputHistograms->GetGrpBin(variableContainer, dataVector->GetId()));
+            groupweight = fInputHistograms->GetGrpBinContent(fInputHistograms->GetGrpBin(variableContainer, ids[ixData]));
           }
           else {
             if (fHardCodedWeights != NULL) {
-              groupweight = fHardCodedWeights[dataVector->GetId()];
+              groupweight = fHardCodedWeights[ids[ixData]];
             }
           }
           if (fMinimumSignificantValue < average)
-            dataVector->SetEqualizedWeight((dataVector->EqualizedWeight() / average) * groupweight);
+            weights[ixData] = (weights[ixData] / average) * groupweight;
           else
-            dataVector->SetEqualizedWeight(0.0);
+            weights[ixData] = 0.0;
         }
         else {
-          if (fQANotValidatedBin != NULL) fQANotValidatedBin->Fill(variableContainer, dataVector->GetId(), 1.0);
+          if (fQANotValidatedBin != NULL) fQANotValidatedBin->Fill(variableContainer, ids[ixData], 1.0);
         }
       }
       break;
     case GEQUAL_widthEqualization:
-      for(Int_t ixData = 0; ixData < fDetectorConfiguration->GetInputDataBank()->GetEntriesFast(); ixData++){
-        AliQnCorrectionsDataVectorChannelized *dataVector =
-            static_cast<AliQnCorrectionsDataVectorChannelized *>(fDetectorConfiguration->GetInputDataBank()->At(ixData));
-        Long64_t bin = fInputHistograms->GetBin(variableContainer, dataVector->GetId());
+      for(Int_t ixData = 0; ixData < nData; ixData++){
+        Long64_t bin = fInputHistograms->GetBin(variableContainer, ids[ixData]);
         if (fInputHistograms->BinContentValidated(bin)) {
-          Float_t average = fInputHistograms->GetBinContent(fInputHistograms->GetBin(variableContainer, dataVector->GetId()));
-          Float_t width = fInputHistograms->GetBinError(fInputHistograms->GetBin(variableContainer, dataVector->GetId()));
+          Float_t average = fInputHistograms->GetBinContent(bin);
+          Float_t width = fInputHistograms->GetBinError(bin);
           /* let's handle the potential group weights usage */
           Float_t groupweight = 1.0;
           if (fUseChannelGroupsWeights) {
-            groupweight = fInputHistograms->GetGrpBinContent(fInputHistograms->GetGrpBin(variableContainer, dataVector->GetId()));
+            groupweight = fInputHistograms->GetGrpBinContent(fInputHistograms->GetGrpBin(variableContainer, ids[ixData]));
           }
           else {
             if (fHardCodedWeights != NULL) {
-              groupweight = fHardCodedWeights[dataVector->GetId()];
+              groupweight = fHardCodedWeights[ids[ixData]];
             }
           }
           if (fMinimumSignificantValue < average)
-            dataVector->SetEqualizedWeight((fShift + fScale * (dataVector->EqualizedWeight() - average) / width) * groupweight);
+            weights[ixData] = (fShift + fScale * (weights[ixData] - average) / width) * groupweight;
           else
-            dataVector->SetEqualizedWeight(0.0);
+            weights[ixData] = 0.0;
         }
         else {
-          if (fQANotValidatedBin != NULL) fQANotValidatedBin->Fill(variableContainer, dataVector->GetId(), 1.0);
+          if (fQANotValidatedBin != NULL) fQANotValidatedBin->Fill(variableContainer, ids[ixData], 1.0);
         }
       }
       break;
     }
     /* collect QA data if asked */
     if (fQAMultiplicityAfter != NULL) {
-      for(Int_t ixData = 0; ixData < fDetectorConfiguration->GetInputDataBank()->GetEntriesFast(); ixData++){
-        AliQnCorrectionsDataVectorChannelized *dataVector =
-            static_cast<AliQnCorrectionsDataVectorChannelized *>(fDetectorConfiguration->GetInputDataBank()->At(ixData));
-        fQAMultiplicityAfter->Fill(variableContainer, dataVector->GetId(), dataVector->EqualizedWeight());
+      for(Int_t ixData = 0; ixData < nData; ixData++){
+        fQAMultiplicityAfter->Fill(variableContainer, ids[ixData], weights[ixData]);
       }
     }
     break;
@@ -42,6 +42,7 @@ public:
 
   void Add(AliQnCorrectionsQnVectorBuild* qvec);
   void Add(Double_t phi, Double_t weight = 1.0);
+  void Add(const Float_t *phi, const Float_t *weight, Int_t n);
 
   /// Check the quality of the constructed Qn vector
   /// Current criteria is number of contributors should be at least one.
@@ -88,6 +89,36 @@ inline void AliQnCorrectionsQnVectorBuild::Add(Double_t phi, Double_t weight) {
   fN += 1;
 }
 
+/// Adds a set of contributions to the build Q vector
+/// Equivalent to adding them one by one but the handled harmonics are
+/// only looked up once for the whole set. The contributions are
+/// incorporated in the passed order so the resulting Q vector is
+/// identical.
+/// \param phi the azimuthal angles of the contributions
+/// \param weight the weights of the contributions
+/// \param n the number of contributions
+inline void AliQnCorrectionsQnVectorBuild::Add(const Float_t *phi, const Float_t *weight, Int_t n) {
+
+  Int_t harmonics[MAXHARMONICNUMBERSUPPORTED+1];
+  Int_t nHarmonics = 0;
+  for(Int_t h = 1; h < fHighestHarmonic + 1; h++){
+    if ((fHarmonicMask & harmonicNumberMask[h]) == harmonicNumberMask[h]) {
+      harmonics[nHarmonics++] = h;
+    }
+  }
+  for (Int_t i = 0; i < n; i++) {
+    Double_t w = weight[i];
+    if (w < fMinimumSignificantValue) continue;
+    Double_t angle = phi[i];
+    for (Int_t ih = 0; ih < nHarmonics; ih++) {
+      Int_t h = harmonics[ih];
+      fQnX[h] += (w * TMath::Cos(h*fHarmonicMultiplier*angle));
+      fQnY[h] += (w * TMath::Sin(h*fHarmonicMultiplier*angle));
+    }
+    fSumW += w;
+    fN += 1;
+  }
+}
 
 /// Calibrates the Q vector according to the method passed
 /// \param method the method of calibration
@@ -23,6 +23,7 @@
 #pragma link C++ class AliQnCorrectionsCutValue+;
 #pragma link C++ class AliQnCorrectionsCutWithin+;
 #pragma link C++ class AliQnCorrectionsDataVector+;
+#pragma link C++ class AliQnCorrectionsDataVectorBank+;
 #pragma link C++ class AliQnCorrectionsDataVectorChannelized+;
 #pragma link C++ class AliQnCorrectionsDetector+;
 #pragma link C++ class AliQnCorrectionsDetectorConfigurationBase+;